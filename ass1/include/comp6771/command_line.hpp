@@ -0,0 +1,18 @@
+#ifndef COMP6771_COMMAND_LINE_HPP
+#define COMP6771_COMMAND_LINE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace word_ladder {
+	// the whole of text as a count, or nothing after telling the user on stderr which of tool's
+	// options was given a bad value (so that --threads abc is a usage error rather than an uncaught
+	// exception). the value must be all digits, so negative numbers are rejected rather than
+	// wrapped into huge counts.
+	[[nodiscard]] auto parse_count(std::string const& tool,
+	                               std::string const& option,
+	                               std::string const& text) -> std::optional<std::uint64_t>;
+} // namespace word_ladder
+
+#endif // COMP6771_COMMAND_LINE_HPP
@@ -0,0 +1,56 @@
+#ifndef COMP6771_DELETION_INDEX_HPP
+#define COMP6771_DELETION_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// symmetric-deletion index (as used by SymSpell style spell checkers) over a lexicon of mixed
+	// word lengths. every word is filed under the hash of itself and under the hash of each string
+	// obtained by deleting one of its letters, so any two words that are one substitution,
+	// insertion or deletion apart always share at least one key. candidates found through a shared
+	// key are verified with is_single_edit, which also filters out transpositions and hash
+	// collisions.
+	class deletion_index {
+	public:
+		explicit deletion_index(std::unordered_set<std::string> const& lexicon);
+
+		[[nodiscard]] auto contains(std::string const& word) const -> bool;
+		[[nodiscard]] auto size() const -> std::size_t;
+
+		// returns all lexicon words one substitution, insertion or deletion away from word, sorted
+		// lexicographically. word itself does not need to be in the lexicon and is never returned.
+		[[nodiscard]] auto neighbours(std::string const& word) const -> std::vector<std::string>;
+
+	private:
+		// appends ids of every word filed under the given key
+		auto collect(std::string_view key, std::vector<std::uint32_t>& ids) const -> void;
+
+		// words in sorted order, so sorting ids also sorts the words they refer to
+		std::vector<std::string> words_;
+		// (key hash, word id) pairs sorted by hash, looked up with equal_range
+		std::vector<std::pair<std::size_t, std::uint32_t>> postings_;
+	};
+
+	// true if a and b differ by exactly one substitution, insertion or deletion
+	[[nodiscard]] auto is_single_edit(std::string_view a, std::string_view b) -> bool;
+
+	// same as generate, except that a step may also insert or delete a single letter, so from and
+	// to may have different lengths. Pre: lexicon contains from and to
+	[[nodiscard]] auto generate_extended(std::string const& from,
+	                                     std::string const& to,
+	                                     deletion_index const& index)
+	   -> std::vector<std::vector<std::string>>;
+
+	[[nodiscard]] auto generate_extended(std::string const& from,
+	                                     std::string const& to,
+	                                     std::unordered_set<std::string> const& lexicon)
+	   -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_DELETION_INDEX_HPP
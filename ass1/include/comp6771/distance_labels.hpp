@@ -0,0 +1,67 @@
+#ifndef COMP6771_DISTANCE_LABELS_HPP
+#define COMP6771_DISTANCE_LABELS_HPP
+
+#include <comp6771/ladder_graph.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace word_ladder {
+	// exact ladder distances by pruned landmark labeling (akiba, iwata and yoshida, 2013). every
+	// word gets a label: a list of (hub, distance) pairs sorted by hub, such that for any two words
+	// of a connected pair, some common hub lies on a shortest ladder between them. a distance query
+	// is then a merge of two sorted lists, with no search at all.
+	//
+	// hubs are processed per length bucket in descending degree order, with a bfs from each hub that
+	// stops wherever the labels built so far already prove a distance at least as short. buckets
+	// are independent, so they are labelled in parallel. hubs are numbered by their rank within the
+	// bucket.
+	//
+	// the labels refer to the graph by id; the graph must outlive them.
+	class distance_labels {
+	public:
+		using id_type = ladder_graph_view::id_type;
+
+		// labels every bucket of the graph on up to threads threads (0 means
+		// std::thread::hardware_concurrency())
+		explicit distance_labels(ladder_graph_view graph, unsigned threads = 0);
+
+		// reads labels written by save. throws std::runtime_error if the file is not a label file
+		// or was built for a different graph, including the same lexicon numbered in another
+		// graph_order (the file holds a fingerprint of the words and edges in id order).
+		[[nodiscard]] static auto load(std::string const& path, ladder_graph_view graph)
+		   -> distance_labels;
+		auto save(std::string const& path) const -> void;
+
+		// number of letter changes on a shortest ladder, std::nullopt if there is no ladder
+		[[nodiscard]] auto distance(id_type from, id_type to) const -> std::optional<int>;
+		[[nodiscard]] auto distance(std::string_view from, std::string_view to) const
+		   -> std::optional<int>;
+
+		// full ladders when they are needed: words the labels prove unconnected return straight
+		// away, everything else falls back to generate on the labelled graph
+		[[nodiscard]] auto ladders(std::string const& from, std::string const& to) const
+		   -> std::vector<std::vector<std::string>>;
+
+		// total number of (hub, distance) pairs over all labels
+		[[nodiscard]] auto label_entries() const -> std::size_t;
+
+	private:
+		// empty labels, filled in by load
+		struct unlabelled {};
+		distance_labels(ladder_graph_view graph, unlabelled)
+		: graph_(graph) {}
+
+		ladder_graph_view graph_;
+		// label of id is hubs_/distances_[label_offsets_[id], label_offsets_[id + 1])
+		std::vector<std::uint64_t> label_offsets_;
+		std::vector<std::uint32_t> hubs_;
+		std::vector<std::uint16_t> distances_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_DISTANCE_LABELS_HPP
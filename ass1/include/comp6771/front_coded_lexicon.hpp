@@ -0,0 +1,75 @@
+#ifndef COMP6771_FRONT_CODED_LEXICON_HPP
+#define COMP6771_FRONT_CODED_LEXICON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// read only lexicon stored as front coded sorted blocks. words are sorted and cut into blocks of
+	// block_size; the first word of a block is stored whole, every later word as (length of the
+	// prefix shared with the previous word, remaining suffix), with both lengths as varints. lookups
+	// binary search the block heads and decode a single block, so the whole lexicon costs little
+	// more than its distinct suffix bytes plus one offset per block, instead of a node, a bucket
+	// and a string per word as in std::unordered_set<std::string>. block offsets are 32 bits, so the
+	// encoded words are limited to 4 GiB (std::length_error beyond that).
+	class front_coded_lexicon {
+	public:
+		static constexpr std::size_t block_size = 16;
+
+		front_coded_lexicon() = default;
+		// words may be in any order and contain duplicates
+		explicit front_coded_lexicon(std::vector<std::string> words);
+		explicit front_coded_lexicon(std::unordered_set<std::string> const& lexicon);
+
+		[[nodiscard]] auto contains(std::string_view word) const -> bool;
+		[[nodiscard]] auto size() const -> std::size_t;
+		// bytes held by the encoded blocks and block offsets
+		[[nodiscard]] auto memory_usage() const -> std::size_t;
+
+		// every word of the same length as pattern that matches it at all positions except
+		// wildcard, sorted. pattern itself is included if it is in the lexicon.
+		[[nodiscard]] auto match(std::string_view pattern, std::size_t wildcard) const
+		   -> std::vector<std::string>;
+
+		// all words in sorted order
+		[[nodiscard]] auto words() const -> std::vector<std::string>;
+
+		// every word of any of lexicons, merged straight from their blocks without building
+		// strings for all of them
+		[[nodiscard]] static auto merge(std::vector<front_coded_lexicon> const& lexicons)
+		   -> front_coded_lexicon;
+
+	private:
+		// appends words, in increasing order, to the blocks of a new lexicon
+		class encoder;
+
+		// first word of the given block, pointing into data_
+		[[nodiscard]] auto block_head(std::size_t block) const -> std::string_view;
+		// number of words stored in the given block
+		[[nodiscard]] auto block_words(std::size_t block) const -> std::size_t;
+
+		std::string data_;
+		std::vector<std::uint32_t> block_offsets_;
+		std::size_t size_ = 0;
+		// every distinct byte used by some word, in ascending order
+		std::string alphabet_;
+	};
+
+	// reads a whitespace separated word list straight into a front coded lexicon, without building
+	// an unordered_set or a vector of every word first. the words are read in runs that are sorted
+	// and front coded as they come, and the runs are then merged, so only one run's words are ever
+	// held as strings.
+	[[nodiscard]] auto read_front_coded_lexicon(std::string const& path) -> front_coded_lexicon;
+
+	// same ladders as generate, looking neighbours up in a front coded lexicon
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            front_coded_lexicon const& lexicon)
+	   -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_FRONT_CODED_LEXICON_HPP
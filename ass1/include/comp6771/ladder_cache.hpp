@@ -0,0 +1,95 @@
+#ifndef COMP6771_LADDER_CACHE_HPP
+#define COMP6771_LADDER_CACHE_HPP
+
+#include <comp6771/ladder_dag.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// bounded lru cache of shortest path dags keyed by (from, to), safe to share between threads.
+	// entries are spread over up to shards independently locked shards, each with its own lru
+	// order. capacity is split between them as evenly as possible (fewer shards are used when
+	// capacity is smaller than shards, so that none is empty), and they add up to exactly capacity.
+	// a query for (to, from) is answered from a cached (from, to) dag by reversing it.
+	//
+	// the cache cannot see the lexicon, so whoever changes the lexicon must call invalidate().
+	// results computed against the old lexicon that finish after invalidate() are not inserted.
+	class ladder_cache {
+	public:
+		explicit ladder_cache(std::size_t capacity, std::size_t shards = 16);
+
+		// returns the cached dag for (from, to) or the reverse of the cached dag for (to, from),
+		// nullptr if neither is cached. counts as a hit or a miss.
+		[[nodiscard]] auto find(std::string const& from, std::string const& to)
+		   -> std::shared_ptr<ladder_dag const>;
+
+		// same as enumerate_ladders(build_ladder_dag(from, to, lexicon, alphabet)), reusing and
+		// filling the cache. alphabet is the lexicon's, built once by the caller.
+		[[nodiscard]] auto generate(std::string const& from,
+		                            std::string const& to,
+		                            std::unordered_set<std::string> const& lexicon,
+		                            position_alphabet const& alphabet)
+		   -> std::vector<std::vector<std::string>>;
+
+		// same as above, with a custom neighbour relation (e.g. deletion_index::neighbours). a
+		// cache must only ever be used with one neighbour relation.
+		[[nodiscard]] auto generate(std::string const& from,
+		                            std::string const& to,
+		                            neighbour_function const& neighbours)
+		   -> std::vector<std::vector<std::string>>;
+
+		// drops every entry. call whenever the lexicon the cached dags were built from changes.
+		auto invalidate() -> void;
+
+		[[nodiscard]] auto hits() const -> std::uint64_t;
+		[[nodiscard]] auto misses() const -> std::uint64_t;
+		[[nodiscard]] auto size() const -> std::size_t;
+		[[nodiscard]] auto capacity() const -> std::size_t;
+
+	private:
+		using key_type = std::pair<std::string, std::string>;
+
+		struct key_hash {
+			auto operator()(key_type const& key) const -> std::size_t;
+		};
+
+		struct entry {
+			key_type key;
+			std::shared_ptr<ladder_dag const> dag;
+		};
+
+		// most recently used entry at the front of lru
+		struct shard {
+			mutable std::mutex mutex;
+			std::size_t capacity = 0;
+			std::list<entry> lru;
+			std::unordered_map<key_type, std::list<entry>::iterator, key_hash> entries;
+		};
+
+		auto shard_for(key_type const& key) -> shard&;
+		auto lookup(key_type const& key) -> std::shared_ptr<ladder_dag const>;
+		auto insert(key_type key, std::shared_ptr<ladder_dag const> dag, std::uint64_t generation)
+		   -> void;
+		template<typename Build>
+		auto generate_with(std::string const& from, std::string const& to, Build build)
+		   -> std::vector<std::vector<std::string>>;
+
+		std::size_t capacity_;
+		std::vector<shard> shards_;
+		std::atomic<std::uint64_t> generation_ = 0;
+		std::atomic<std::uint64_t> hits_ = 0;
+		std::atomic<std::uint64_t> misses_ = 0;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_LADDER_CACHE_HPP
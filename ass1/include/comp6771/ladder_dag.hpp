@@ -0,0 +1,106 @@
+#ifndef COMP6771_LADDER_DAG_HPP
+#define COMP6771_LADDER_DAG_HPP
+
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/position_alphabet.hpp>
+#include <comp6771/stop_check.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// compact shortest path dag between two words. only words that lie on some shortest ladder are
+	// kept, ids are assigned in sorted word order and successor lists are stored in csr form
+	// (successors of id are targets[offsets[id]] to targets[offsets[id + 1]]) in ascending id order,
+	// so a depth first walk yields ladders in lexicographic order. an empty dag means no ladder.
+	struct ladder_dag {
+		std::vector<std::string> words;
+		std::vector<std::uint32_t> offsets;
+		std::vector<std::uint32_t> targets;
+		std::uint32_t source = 0;
+		std::uint32_t target = 0;
+
+		[[nodiscard]] auto empty() const -> bool {
+			return words.empty();
+		}
+
+		[[nodiscard]] auto successors(std::uint32_t id) const -> std::span<std::uint32_t const> {
+			return {targets.data() + offsets[id], targets.data() + offsets[id + 1]};
+		}
+	};
+
+	// returns the words adjacent to the given word
+	using neighbour_function = std::function<std::vector<std::string>(std::string const&)>;
+
+	// level by level bfs from "from" that stops after the level containing "to", then pruned back to
+	// the edges that still lead to "to". neighbours must be symmetric.
+	[[nodiscard]] auto build_ladder_dag(std::string const& from,
+	                                    std::string const& to,
+	                                    neighbour_function const& neighbours) -> ladder_dag;
+
+	// same as above, using single letter substitutions within the lexicon (as generate does). the
+	// first form builds the lexicon's position_alphabet itself, which reads every word; searches
+	// that run many queries against one lexicon should build it once and pass it in.
+	[[nodiscard]] auto build_ladder_dag(std::string const& from,
+	                                    std::string const& to,
+	                                    std::unordered_set<std::string> const& lexicon)
+	   -> ladder_dag;
+	[[nodiscard]] auto build_ladder_dag(std::string const& from,
+	                                    std::string const& to,
+	                                    std::unordered_set<std::string> const& lexicon,
+	                                    position_alphabet const& alphabet) -> ladder_dag;
+
+	// same as above on a prebuilt ladder graph, walking neighbour ids instead of probing spellings
+	[[nodiscard]] auto build_ladder_dag(std::string const& from,
+	                                    std::string const& to,
+	                                    ladder_graph_view graph) -> ladder_dag;
+
+	// the searches above, polling stop once per word expanded (so they throw ladder_query_stopped
+	// when it fires). without an alphabet, stop is also polled while the alphabet is built.
+	[[nodiscard]] auto build_ladder_dag(std::string const& from,
+	                                    std::string const& to,
+	                                    std::unordered_set<std::string> const& lexicon,
+	                                    stop_check& stop) -> ladder_dag;
+	[[nodiscard]] auto build_ladder_dag(std::string const& from,
+	                                    std::string const& to,
+	                                    std::unordered_set<std::string> const& lexicon,
+	                                    position_alphabet const& alphabet,
+	                                    stop_check& stop) -> ladder_dag;
+	[[nodiscard]] auto build_ladder_dag(std::string const& from,
+	                                    std::string const& to,
+	                                    ladder_graph_view graph,
+	                                    stop_check& stop) -> ladder_dag;
+
+	// same ladders as generate, from a prebuilt (possibly mapped) ladder graph
+	[[nodiscard]] auto generate(std::string const& from, std::string const& to, ladder_graph_view graph)
+	   -> std::vector<std::vector<std::string>>;
+
+	// the dag of ladders from dag.target to dag.source. since the neighbour relation is symmetric
+	// this is exactly the dag build_ladder_dag(to, from, ...) would produce.
+	[[nodiscard]] auto reverse(ladder_dag const& dag) -> ladder_dag;
+
+	// every ladder in the dag, in lexicographic order (the same output generate gives)
+	[[nodiscard]] auto enumerate_ladders(ladder_dag const& dag)
+	   -> std::vector<std::vector<std::string>>;
+
+	// same, polling stop once per word visited by the depth first walk
+	[[nodiscard]] auto enumerate_ladders(ladder_dag const& dag, stop_check& stop)
+	   -> std::vector<std::vector<std::string>>;
+
+	// same output as enumerate_ladders, with the dag split into subtrees below its first levels that
+	// are enumerated on up to threads threads (0 means std::thread::hardware_concurrency())
+	[[nodiscard]] auto enumerate_ladders_parallel(ladder_dag const& dag, unsigned threads = 0)
+	   -> std::vector<std::vector<std::string>>;
+
+	// byte for byte the same result as generate, with the ladders enumerated in parallel
+	[[nodiscard]] auto generate_parallel(std::string const& from,
+	                                     std::string const& to,
+	                                     std::unordered_set<std::string> const& lexicon,
+	                                     unsigned threads = 0) -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_LADDER_DAG_HPP
@@ -0,0 +1,110 @@
+#ifndef COMP6771_LADDER_GRAPH_HPP
+#define COMP6771_LADDER_GRAPH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	class ladder_graph_view;
+	auto save_ladder_graph(ladder_graph_view graph, std::string const& path) -> void;
+
+	// read only view of a ladder graph: every lexicon word gets an integer id, and ids of words one
+	// letter substitution apart are connected. words of the same length occupy one contiguous id
+	// range (their length bucket), since ladders never leave a bucket. the view only points at its
+	// arrays, so the same algorithms run on an owning ladder_graph and on a graph mapped from disk.
+	//
+	// within a bucket, ids may follow any order (see graph_order); by_word keeps lookups by spelling
+	// working whatever the numbering.
+	//
+	//     chars          every word's letters back to back, in id order
+	//     word_offsets   word id is chars[word_offsets[id], word_offsets[id + 1])
+	//     offsets        neighbours of id are targets[offsets[id], offsets[id + 1]) (csr)
+	//     targets        neighbour ids, ascending for each word
+	//     by_word        ids ordered by (length, word), for lookups by spelling
+	//     bucket_offsets words of length n have the ids in [bucket_offsets[n], bucket_offsets[n + 1])
+	class ladder_graph_view {
+	public:
+		using id_type = std::uint32_t;
+		static constexpr id_type npos = std::numeric_limits<id_type>::max();
+
+		ladder_graph_view() = default;
+		ladder_graph_view(std::string_view chars,
+		                  std::span<std::uint32_t const> word_offsets,
+		                  std::span<std::uint64_t const> offsets,
+		                  std::span<id_type const> targets,
+		                  std::span<id_type const> by_word,
+		                  std::span<id_type const> bucket_offsets);
+
+		[[nodiscard]] auto size() const -> std::size_t;
+		[[nodiscard]] auto edge_count() const -> std::size_t;
+		[[nodiscard]] auto word(id_type id) const -> std::string_view;
+		// id of the given word, npos if it is not in the graph
+		[[nodiscard]] auto find(std::string_view word) const -> id_type;
+		[[nodiscard]] auto neighbours(id_type id) const -> std::span<id_type const>;
+
+		// longest word length, and the id range holding the words of the given length
+		[[nodiscard]] auto max_length() const -> std::size_t;
+		[[nodiscard]] auto bucket(std::size_t length) const -> std::pair<id_type, id_type>;
+
+	private:
+		friend auto save_ladder_graph(ladder_graph_view graph, std::string const& path) -> void;
+
+		std::string_view chars_;
+		std::span<std::uint32_t const> word_offsets_;
+		std::span<std::uint64_t const> offsets_;
+		std::span<id_type const> targets_;
+		std::span<id_type const> by_word_;
+		std::span<id_type const> bucket_offsets_;
+	};
+
+	// numbering of the words within each length bucket. a bfs touches a word's neighbours right after
+	// the word, so orders that keep neighbours at nearby ids keep their adjacency lists and visited
+	// flags on nearby cache lines.
+	//
+	//     alphabetical            ids in spelling order
+	//     bfs                     breadth first order, one component after another, each started
+	//                             from its alphabetically first word
+	//     reverse_cuthill_mckee   bfs from a minimum degree word, visiting neighbours by ascending
+	//                             degree, then reversed; keeps the id gap along edges small
+	//     degree                  descending degree, so the well connected words share cache lines
+	enum class graph_order { alphabetical, bfs, reverse_cuthill_mckee, degree };
+
+	// owning ladder graph built from a lexicon. neighbours are every single byte substitution that
+	// is in the lexicon, probing only the letters position_alphabet finds at each position, so for
+	// lower case lexicons ladders over the graph match generate's, and any other bytes work too.
+	// the words are limited to 4 GiB of text (std::length_error beyond that).
+	class ladder_graph {
+	public:
+		using id_type = ladder_graph_view::id_type;
+
+		ladder_graph() = default;
+		explicit ladder_graph(std::unordered_set<std::string> const& lexicon,
+		                      graph_order order = graph_order::alphabetical);
+
+		[[nodiscard]] auto view() const -> ladder_graph_view;
+		// NOLINTNEXTLINE(google-explicit-constructor)
+		operator ladder_graph_view() const {
+			return view();
+		}
+
+	private:
+		// renumbers every word old_ids[new id] (each bucket maps onto itself)
+		auto renumber(std::vector<id_type> const& old_ids) -> void;
+
+		std::string chars_;
+		std::vector<std::uint32_t> word_offsets_;
+		std::vector<std::uint64_t> offsets_;
+		std::vector<id_type> targets_;
+		std::vector<id_type> by_word_;
+		std::vector<id_type> bucket_offsets_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_LADDER_GRAPH_HPP
@@ -0,0 +1,64 @@
+#ifndef COMP6771_LADDER_PAIRS_HPP
+#define COMP6771_LADDER_PAIRS_HPP
+
+#include <comp6771/ladder_graph.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace word_ladder {
+	// a pair of words whose shortest ladder has exactly the requested number of steps
+	struct ladder_pair {
+		ladder_graph_view::id_type from = 0;
+		ladder_graph_view::id_type to = 0;
+		// number of shortest ladders from "from" to "to"
+		std::uint64_t ladders = 0;
+
+		friend auto operator==(ladder_pair const&, ladder_pair const&) -> bool = default;
+	};
+
+	struct ladder_pair_options {
+		// steps on the shortest ladder (a ladder of distance + 1 words)
+		std::size_t distance = 0;
+		// pairs with more shortest ladders than this are dropped
+		std::uint64_t max_ladders = 1;
+		// number of source words, drawn without replacement. every word is a source if there are
+		// fewer words than this.
+		std::size_t sources = 1000;
+		// only draw sources of this length (0 means any length)
+		std::size_t length = 0;
+		std::uint64_t seed = 0;
+		// 0 means std::thread::hardware_concurrency()
+		unsigned threads = 0;
+	};
+
+	// receives the qualifying pairs of one source at a time, in ascending "to" order
+	using ladder_pair_sink = std::function<void(std::span<ladder_pair const>)>;
+
+	// finds (from, to) pairs for puzzles: for each sampled source, a bfs over the graph counts the
+	// shortest ladders to every word while it stops after the level at the requested distance, and
+	// the words of that level with few enough ladders are paired with the source. ladder counts
+	// saturate just above max_ladders (at the largest uint64 when max_ladders is the largest, which
+	// means no limit), so they never wrap.
+	//
+	// sources are shared out between threads, each with bfs scratch arrays the size of the largest
+	// bucket that are reset word by word after each source, so memory stays at threads times the
+	// largest bucket however many pairs are found. the sink is called under a lock, one source at a
+	// time, in no particular source order. the same seed always draws the same sources. a pair is
+	// directed: both (a, b) and (b, a) are reported when a and b are both drawn.
+	//
+	// if the sink throws, no more sources are started or reported, and the first exception is
+	// rethrown on the calling thread once every thread has stopped.
+	auto find_ladder_pairs(ladder_graph_view graph,
+	                       ladder_pair_options const& options,
+	                       ladder_pair_sink const& sink) -> void;
+
+	// every pair find_ladder_pairs streams, ordered by (from, to)
+	[[nodiscard]] auto find_ladder_pairs(ladder_graph_view graph, ladder_pair_options const& options)
+	   -> std::vector<ladder_pair>;
+} // namespace word_ladder
+
+#endif // COMP6771_LADDER_PAIRS_HPP
@@ -0,0 +1,69 @@
+#ifndef COMP6771_LADDER_QUERY_HPP
+#define COMP6771_LADDER_QUERY_HPP
+
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/position_alphabet.hpp>
+#include <comp6771/stop_check.hpp>
+
+#include <future>
+#include <stop_token>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// ladder queries that can be abandoned part way. the bfs polls the stop_check once per word it
+	// expands and the depth first enumeration once per word it visits, so a stop request or a
+	// passed deadline is noticed within stop_check::interval steps, and the query throws
+	// ladder_query_stopped instead of finishing. the ladders are the same as generate's.
+	//
+	// without an alphabet, the lexicon's position_alphabet is built first (polling stop as it goes);
+	// callers running many queries should build it once and pass it in.
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            std::unordered_set<std::string> const& lexicon,
+	                            stop_check& stop) -> std::vector<std::vector<std::string>>;
+
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            std::unordered_set<std::string> const& lexicon,
+	                            position_alphabet const& alphabet,
+	                            stop_check& stop) -> std::vector<std::vector<std::string>>;
+
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            ladder_graph_view graph,
+	                            stop_check& stop) -> std::vector<std::vector<std::string>>;
+
+	// runs the query on a thread of its own. the future holds the ladders, or ladder_query_stopped
+	// if stop was requested or the deadline passed first. the lexicon (or the graph's storage) must
+	// outlive the query, and like any std::async future, destroying it waits for the query, which
+	// a stop request cuts short.
+	[[nodiscard]] auto generate_async(std::string from,
+	                                  std::string to,
+	                                  std::unordered_set<std::string> const& lexicon,
+	                                  std::stop_token stop = {},
+	                                  stop_check::clock::time_point deadline =
+	                                     stop_check::clock::time_point::max())
+	   -> std::future<std::vector<std::vector<std::string>>>;
+
+	// same, with the lexicon's alphabet built once by the caller. it must outlive the query too.
+	[[nodiscard]] auto generate_async(std::string from,
+	                                  std::string to,
+	                                  std::unordered_set<std::string> const& lexicon,
+	                                  position_alphabet const& alphabet,
+	                                  std::stop_token stop = {},
+	                                  stop_check::clock::time_point deadline =
+	                                     stop_check::clock::time_point::max())
+	   -> std::future<std::vector<std::vector<std::string>>>;
+
+	[[nodiscard]] auto generate_async(std::string from,
+	                                  std::string to,
+	                                  ladder_graph_view graph,
+	                                  std::stop_token stop = {},
+	                                  stop_check::clock::time_point deadline =
+	                                     stop_check::clock::time_point::max())
+	   -> std::future<std::vector<std::vector<std::string>>>;
+} // namespace word_ladder
+
+#endif // COMP6771_LADDER_QUERY_HPP
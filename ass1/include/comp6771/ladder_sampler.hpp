@@ -0,0 +1,57 @@
+#ifndef COMP6771_LADDER_SAMPLER_HPP
+#define COMP6771_LADDER_SAMPLER_HPP
+
+#include <comp6771/ladder_dag.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// draws shortest ladders uniformly at random without enumerating them. construction counts the
+	// ladders from every word in the dag to the target (o(words + edges)) and builds a walker alias
+	// table over each word's successors, weighted by those counts. a sample is then a walk from the
+	// source that picks each next word in o(1), so k ladders cost o(k * ladder length).
+	class ladder_sampler {
+	public:
+		explicit ladder_sampler(ladder_dag dag);
+
+		// number of shortest ladders (a double, so huge dags saturate gracefully instead of
+		// wrapping; sampling stays uniform while counts fit in 53 bits)
+		[[nodiscard]] auto count() const -> double;
+
+		// one uniformly chosen ladder, empty if there is no ladder
+		[[nodiscard]] auto sample(std::mt19937_64& rng) const -> std::vector<std::string>;
+
+		// k independent uniformly chosen ladders. the same seed always gives the same ladders.
+		[[nodiscard]] auto sample(std::size_t k, std::uint64_t seed) const
+		   -> std::vector<std::vector<std::string>>;
+
+	private:
+		ladder_dag dag_;
+		std::vector<double> ladders_from_;
+		// alias table entries, one per dag edge, laid out like dag_.targets
+		std::vector<double> threshold_;
+		std::vector<std::uint32_t> alias_;
+	};
+
+	// k uniformly chosen shortest ladders from "from" to "to", reproducible for a given seed
+	[[nodiscard]] auto sample_ladders(std::string const& from,
+	                                  std::string const& to,
+	                                  std::unordered_set<std::string> const& lexicon,
+	                                  std::size_t k,
+	                                  std::uint64_t seed) -> std::vector<std::vector<std::string>>;
+
+	// same, with the lexicon's alphabet built once by the caller instead of on every call
+	[[nodiscard]] auto sample_ladders(std::string const& from,
+	                                  std::string const& to,
+	                                  std::unordered_set<std::string> const& lexicon,
+	                                  position_alphabet const& alphabet,
+	                                  std::size_t k,
+	                                  std::uint64_t seed) -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_LADDER_SAMPLER_HPP
@@ -0,0 +1,44 @@
+#ifndef COMP6771_MAPPED_LADDER_GRAPH_HPP
+#define COMP6771_MAPPED_LADDER_GRAPH_HPP
+
+#include <comp6771/ladder_graph.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace word_ladder {
+	// writes the graph as a single flat file: a fixed header followed by the view's arrays, each
+	// 8 byte aligned and located by its byte offset from the start of the file, so the file can be
+	// used in place at whatever address it is mapped. the file is written under a temporary name and
+	// renamed into place, so workers never attach to a half written index. put it under /dev/shm to
+	// keep it in posix shared memory rather than on disk.
+	auto save_ladder_graph(ladder_graph_view graph, std::string const& path) -> void;
+
+	// a ladder graph file mapped read only and shared (MAP_SHARED), so every process on the host
+	// that attaches the same file shares one physical copy through the page cache. attaching only
+	// checks the header against the file size and never reads the arrays, so it takes constant time
+	// regardless of the lexicon size.
+	class mapped_ladder_graph {
+	public:
+		// throws std::runtime_error if the file cannot be mapped or is not a ladder graph file
+		explicit mapped_ladder_graph(std::string const& path);
+		mapped_ladder_graph(mapped_ladder_graph const&) = delete;
+		mapped_ladder_graph(mapped_ladder_graph&& other) noexcept;
+		auto operator=(mapped_ladder_graph const&) -> mapped_ladder_graph& = delete;
+		auto operator=(mapped_ladder_graph&& other) noexcept -> mapped_ladder_graph&;
+		~mapped_ladder_graph();
+
+		[[nodiscard]] auto view() const -> ladder_graph_view;
+		// NOLINTNEXTLINE(google-explicit-constructor)
+		operator ladder_graph_view() const {
+			return view();
+		}
+
+	private:
+		void* address_ = nullptr;
+		std::size_t length_ = 0;
+		ladder_graph_view view_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_MAPPED_LADDER_GRAPH_HPP
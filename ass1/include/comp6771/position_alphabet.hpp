@@ -0,0 +1,63 @@
+#ifndef COMP6771_POSITION_ALPHABET_HPP
+#define COMP6771_POSITION_ALPHABET_HPP
+
+#include <comp6771/stop_check.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// the bytes that occur at each position of the words of each length. a substitution can only
+	// reach a word if its new letter occurs at that position among words of that length, so
+	// neighbour generation loops over these letters instead of 'a' to 'z': positions with only a
+	// handful of letters cost a handful of probes, and lexicons with digits, upper case or any other
+	// bytes get neighbours at all. letters are bytes, so a multi byte utf-8 letter spans several
+	// positions and is substituted a byte at a time.
+	//
+	// building one reads the whole lexicon, so build it once next to the lexicon and pass it to
+	// every search rather than deriving it per query.
+	class position_alphabet {
+	public:
+		position_alphabet() = default;
+		explicit position_alphabet(std::unordered_set<std::string> const& lexicon);
+		// same, polling stop once per word read (so it throws ladder_query_stopped when it fires)
+		position_alphabet(std::unordered_set<std::string> const& lexicon, stop_check& stop);
+
+		// letters found at the given position of words of the given length, in ascending unsigned
+		// byte order (so 'a' to 'z' come out in alphabetical order); empty if there are none
+		[[nodiscard]] auto letters(std::size_t length, std::size_t position) const
+		   -> std::string_view;
+		[[nodiscard]] auto contains(std::size_t length, std::size_t position, char letter) const
+		   -> bool;
+		[[nodiscard]] auto max_length() const -> std::size_t;
+
+	private:
+		// rows are (length, position) pairs, length by length, so the rows of a length start at
+		// length * (length - 1) / 2
+		[[nodiscard]] static auto row(std::size_t length, std::size_t position) -> std::size_t;
+
+		std::size_t max_length_ = 0;
+		// one bit per byte value, per row
+		std::vector<std::array<std::uint64_t, 4>> masks_;
+		// letters of row r are letters_[letter_offsets_[r], letter_offsets_[r + 1])
+		std::string letters_;
+		std::vector<std::uint32_t> letter_offsets_;
+	};
+
+	// singleLetterDiff, substituting only the letters the alphabet has at each position
+	auto singleLetterDiff(std::string const& word,
+	                      std::unordered_set<std::string> const& lexicon,
+	                      position_alphabet const& alphabet,
+	                      std::deque<std::string>& single_letter_diff_queue,
+	                      std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map)
+	   -> void;
+} // namespace word_ladder
+
+#endif // COMP6771_POSITION_ALPHABET_HPP
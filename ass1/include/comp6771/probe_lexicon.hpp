@@ -0,0 +1,76 @@
+#ifndef COMP6771_PROBE_LEXICON_HPP
+#define COMP6771_PROBE_LEXICON_HPP
+
+#include <comp6771/position_alphabet.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// read only lexicon for answering many membership probes at once. words are kept back to back
+	// in one buffer and indexed by an open addressing table (linear probing, at most half full) whose
+	// slots hold the full hash next to the word's position, so a probe touches one slot line and
+	// only compares letters on a hash match. the words are limited to 4 GiB of text
+	// (std::length_error beyond that).
+	//
+	// a std::unordered_set probe is a chain of dependent loads (bucket, node, string), and a loop of
+	// finds waits for each chain in turn. contains over a span splits the probes into groups of
+	// batch_size: every candidate of a group is hashed and its slot prefetched first, and only then
+	// are the slots resolved, so the cache misses of a whole group are in flight together.
+	class probe_lexicon {
+	public:
+		static constexpr std::size_t batch_size = 16;
+
+		probe_lexicon() = default;
+		explicit probe_lexicon(std::unordered_set<std::string> const& lexicon);
+
+		[[nodiscard]] auto contains(std::string_view word) const -> bool;
+		// found[i] = contains(words[i]). found.size() must be at least words.size().
+		auto contains(std::span<std::string_view const> words, std::span<bool> found) const -> void;
+		[[nodiscard]] auto size() const -> std::size_t;
+
+		// the words one letter substitution away from word, trying only the letters that occur at
+		// each position (see position_alphabet). for lower case lexicons this is the order
+		// singleLetterDiff finds them in.
+		[[nodiscard]] auto neighbours(std::string const& word) const -> std::vector<std::string>;
+
+	private:
+		struct slot {
+			std::uint64_t hash = 0;
+			std::uint32_t offset = 0;
+			// 0 marks an empty slot, since the empty word never has neighbours
+			std::uint32_t length = 0;
+		};
+
+		[[nodiscard]] auto home(std::uint64_t hash) const -> std::size_t;
+		[[nodiscard]] auto resolve(std::string_view word, std::uint64_t hash) const -> bool;
+
+		std::string chars_;
+		std::vector<slot> slots_;
+		std::size_t size_ = 0;
+		bool has_empty_word_ = false;
+		position_alphabet alphabet_;
+	};
+
+	// singleLetterDiff with the candidates of each word probed as one batch
+	auto singleLetterDiff(std::string const& word,
+	                      probe_lexicon const& lexicon,
+	                      std::deque<std::string>& single_letter_diff_queue,
+	                      std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map)
+	   -> void;
+
+	// same ladders as generate, with neighbours found by batched probes
+	[[nodiscard]] auto generate(std::string const& from,
+	                            std::string const& to,
+	                            probe_lexicon const& lexicon)
+	   -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_PROBE_LEXICON_HPP
@@ -0,0 +1,41 @@
+#ifndef COMP6771_RADIX_HEAP_HPP
+#define COMP6771_RADIX_HEAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// monotone priority queue of (key, value) pairs with integer keys, for dijkstra with non
+	// negative integer weights: no key pushed may be smaller than the last key popped. entries live
+	// in bucket i when their key first differs from the last popped key at bit i - 1 (bucket 0
+	// holds keys equal to it), so a push is o(1), and an entry moves to a lower bucket at most 64
+	// times over its life. popping refills bucket 0 from the first non empty bucket, whose minimum
+	// becomes the new last popped key.
+	class radix_heap {
+	public:
+		using key_type = std::uint64_t;
+		using value_type = std::uint32_t;
+
+		// throws std::logic_error if key is below the last popped key
+		auto push(key_type key, value_type value) -> void;
+		// entry with the smallest key. the heap must not be empty.
+		auto pop() -> std::pair<key_type, value_type>;
+
+		[[nodiscard]] auto empty() const -> bool;
+		[[nodiscard]] auto size() const -> std::size_t;
+
+	private:
+		static constexpr std::size_t bucket_count = 65;
+
+		[[nodiscard]] auto bucket_of(key_type key) const -> std::size_t;
+
+		std::array<std::vector<std::pair<key_type, value_type>>, bucket_count> buckets_;
+		key_type last_ = 0;
+		std::size_t size_ = 0;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_RADIX_HEAP_HPP
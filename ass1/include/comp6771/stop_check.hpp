@@ -0,0 +1,49 @@
+#ifndef COMP6771_STOP_CHECK_HPP
+#define COMP6771_STOP_CHECK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <stop_token>
+
+namespace word_ladder {
+	// thrown out of a ladder query that was asked to stop or ran past its deadline
+	class ladder_query_stopped : public std::runtime_error {
+	public:
+		explicit ladder_query_stopped(bool deadline_passed);
+
+		// true if the deadline passed, false if a stop was requested
+		[[nodiscard]] auto deadline_passed() const -> bool;
+
+	private:
+		bool deadline_passed_;
+	};
+
+	// polled from the inner loops of a ladder search. a poll is a decrement and a branch; only every
+	// interval polls (and on the first one) is the stop token read and, when there is a deadline,
+	// the clock. a default constructed stop_check never stops.
+	class stop_check {
+	public:
+		using clock = std::chrono::steady_clock;
+		static constexpr std::uint32_t interval = 256;
+
+		stop_check() = default;
+		explicit stop_check(std::stop_token token,
+		                    clock::time_point deadline = clock::time_point::max());
+
+		// throws ladder_query_stopped once a stop is requested or the deadline has passed
+		auto poll() -> void {
+			if (--countdown_ == 0) {
+				check();
+			}
+		}
+		auto check() -> void;
+
+	private:
+		std::stop_token token_;
+		clock::time_point deadline_ = clock::time_point::max();
+		std::uint32_t countdown_ = 1;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_STOP_CHECK_HPP
@@ -0,0 +1,42 @@
+#ifndef COMP6771_SYNTHETIC_LEXICON_HPP
+#define COMP6771_SYNTHETIC_LEXICON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace word_ladder {
+	// shape of a synthetic lexicon
+	//
+	//     words           number of distinct words
+	//     min_length      shortest word length
+	//     max_length      longest word length
+	//     length_weights  relative weight of each length from min_length up (missing trailing
+	//                     weights count as 0); empty means every length is equally likely
+	//     alphabet        letters words are spelled with
+	//     density         chance that a new word is an existing word of its length with one letter
+	//                     substituted, rather than uniformly random letters. 0 gives a sparse
+	//                     graph of mostly isolated words, values near 1 give dense clusters of
+	//                     neighbours like a real dictionary's.
+	//     seed            the same options always give the same lexicon
+	struct synthetic_lexicon_options {
+		std::size_t words = 100000;
+		std::size_t min_length = 2;
+		std::size_t max_length = 12;
+		std::vector<double> length_weights;
+		std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+		double density = 0.8;
+		std::uint64_t seed = 1;
+	};
+
+	// distinct words in sorted order. throws std::invalid_argument if the options cannot be met
+	// (no length has a weight, an empty alphabet, or more words than the lengths can spell).
+	[[nodiscard]] auto generate_synthetic_lexicon(synthetic_lexicon_options const& options)
+	   -> std::vector<std::string>;
+
+	// one word per line, readable by read_lexicon
+	auto write_lexicon(std::vector<std::string> const& words, std::string const& path) -> void;
+} // namespace word_ladder
+
+#endif // COMP6771_SYNTHETIC_LEXICON_HPP
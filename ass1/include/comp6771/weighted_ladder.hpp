@@ -0,0 +1,56 @@
+#ifndef COMP6771_WEIGHTED_LADDER_HPP
+#define COMP6771_WEIGHTED_LADDER_HPP
+
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/position_alphabet.hpp>
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// cheapest ladders over the same single letter substitution graph generate uses, where stepping
+	// onto a word costs that word's cost (the cost of "from" itself is never paid). cheap common
+	// words therefore win over rare ones, even at the price of a longer ladder. every cheapest
+	// ladder is returned, in lexicographic order; with all costs 1 this is exactly generate.
+	//
+	// the search is dijkstra on a radix_heap, which suits the small integer path costs. it stops as
+	// soon as "to" is settled. the edges that are tight under the final costs, found walking back
+	// from "to", form a ladder_dag, so the ladders are enumerated the same way as unweighted ones.
+	//
+	// costs must be positive; a zero cost met during the search throws std::invalid_argument.
+
+	// words missing from costs cost 1. substitutions draw on the lexicon's position_alphabet, as
+	// generate's do; the first form builds it per call, the second takes one built beforehand.
+	[[nodiscard]] auto generate_weighted(std::string const& from,
+	                                     std::string const& to,
+	                                     std::unordered_set<std::string> const& lexicon,
+	                                     std::unordered_map<std::string, std::uint32_t> const& costs)
+	   -> std::vector<std::vector<std::string>>;
+	[[nodiscard]] auto generate_weighted(std::string const& from,
+	                                     std::string const& to,
+	                                     std::unordered_set<std::string> const& lexicon,
+	                                     position_alphabet const& alphabet,
+	                                     std::unordered_map<std::string, std::uint32_t> const& costs)
+	   -> std::vector<std::vector<std::string>>;
+
+	// costs[id] is the cost of graph word id. throws std::invalid_argument unless there is one cost
+	// per word.
+	[[nodiscard]] auto generate_weighted(std::string const& from,
+	                                     std::string const& to,
+	                                     ladder_graph_view graph,
+	                                     std::span<std::uint32_t const> costs)
+	   -> std::vector<std::vector<std::string>>;
+
+	// the dag of cheapest ladders behind generate_weighted (empty if there is no ladder)
+	[[nodiscard]] auto build_weighted_ladder_dag(std::string const& from,
+	                                             std::string const& to,
+	                                             ladder_graph_view graph,
+	                                             std::span<std::uint32_t const> costs) -> ladder_dag;
+} // namespace word_ladder
+
+#endif // COMP6771_WEIGHTED_LADDER_HPP
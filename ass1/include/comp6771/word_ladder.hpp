@@ -4,6 +4,8 @@
 #ifndef COMP6771_WORD_LADDER_HPP
 #define COMP6771_WORD_LADDER_HPP
 
+#include <comp6771/position_alphabet.hpp>
+
 #include <unordered_map>
 #include <unordered_set>
 #include <deque>
@@ -23,13 +25,16 @@ namespace word_ladder {
 	                            const std::unordered_set<std::string>& lexicon)
 	   -> std::vector<std::vector<std::string>>;
 
-	// helper function declarations
-	auto
-	singleLetterDiff(const std::string& word,
-	                 const std::unordered_set<std::string>& lexicon,
-	                 std::deque<std::string>& single_letter_diff_queue,
-	                 std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map);
+	// same as above with the lexicon's alphabet built beforehand. generate builds one per call,
+	// which reads the whole lexicon, so callers running many queries should build it once and use
+	// this overload.
+	[[nodiscard]] auto generate(const std::string& from,
+	                            const std::string& to,
+	                            const std::unordered_set<std::string>& lexicon,
+	                            const position_alphabet& alphabet)
+	   -> std::vector<std::vector<std::string>>;
 
+	// helper function declarations
 	auto bfs(const std::string& src_word,
 	         const std::string& dest_word,
 	         const std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map)
@@ -40,7 +45,7 @@ namespace word_ladder {
 	         const std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map,
 	         const std::unordered_map<std::string, int>& num_hops,
 	         std::vector<std::vector<std::string>>& paths,
-	         std::vector<std::string> curr_path);
+	         std::vector<std::string> curr_path) -> void;
 } // namespace word_ladder
 
 #endif // COMP6771_WORD_LADDER_HPP
@@ -0,0 +1,27 @@
+#include <comp6771/command_line.hpp>
+
+#include <cctype>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+
+namespace word_ladder {
+	auto parse_count(std::string const& tool, std::string const& option, std::string const& text)
+	   -> std::optional<std::uint64_t> {
+		try {
+			auto end = std::size_t{0};
+			// std::stoull alone would take -1 (or " -1", since it skips leading space) as a huge
+			// count, so the value must start with a digit
+			if (!text.empty() && std::isdigit(static_cast<unsigned char>(text.front())) != 0) {
+				auto const count = std::stoull(text, &end);
+				if (end == text.size()) {
+					return count;
+				}
+			}
+		} catch (std::logic_error const&) {
+			// std::invalid_argument or std::out_of_range
+		}
+		std::cerr << tool << ": " << option << " expects a count, not \"" << text << "\"\n";
+		return std::nullopt;
+	}
+} // namespace word_ladder
@@ -0,0 +1,117 @@
+#include <comp6771/deletion_index.hpp>
+#include <comp6771/ladder_dag.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace word_ladder {
+	namespace {
+		auto key_hash(std::string_view key) -> std::size_t {
+			return std::hash<std::string_view>{}(key);
+		}
+	} // namespace
+
+	// builds the postings for every word in the lexicon. deleting either letter of a doubled letter
+	// gives the same string, so only the first deletion of each run of equal letters is filed.
+	deletion_index::deletion_index(std::unordered_set<std::string> const& lexicon)
+	: words_(lexicon.begin(), lexicon.end()) {
+		std::sort(words_.begin(), words_.end());
+		auto deleted = std::string();
+		for (auto id = std::uint32_t{0}; id < words_.size(); ++id) {
+			auto const& word = words_[id];
+			postings_.emplace_back(key_hash(word), id);
+			for (auto i = std::size_t{0}; i < word.size(); ++i) {
+				if (i != 0 && word[i] == word[i - 1]) {
+					continue;
+				}
+				deleted.assign(word, 0, i);
+				deleted.append(word, i + 1);
+				postings_.emplace_back(key_hash(deleted), id);
+			}
+		}
+		std::sort(postings_.begin(), postings_.end());
+	}
+
+	auto deletion_index::contains(std::string const& word) const -> bool {
+		return std::binary_search(words_.begin(), words_.end(), word);
+	}
+
+	auto deletion_index::size() const -> std::size_t {
+		return words_.size();
+	}
+
+	auto deletion_index::collect(std::string_view key, std::vector<std::uint32_t>& ids) const -> void {
+		auto const [first, last] =
+		   std::ranges::equal_range(postings_, key_hash(key), {}, &decltype(postings_)::value_type::first);
+		for (auto posting = first; posting != last; ++posting) {
+			ids.push_back(posting->second);
+		}
+	}
+
+	// looks up the word itself (finds words one insertion longer) and each of its deletions (finds
+	// words one deletion shorter and same length words one substitution away), then verifies every
+	// candidate since a shared key does not guarantee a single edit
+	auto deletion_index::neighbours(std::string const& word) const -> std::vector<std::string> {
+		auto ids = std::vector<std::uint32_t>();
+		collect(word, ids);
+		auto deleted = std::string();
+		for (auto i = std::size_t{0}; i < word.size(); ++i) {
+			if (i != 0 && word[i] == word[i - 1]) {
+				continue;
+			}
+			deleted.assign(word, 0, i);
+			deleted.append(word, i + 1);
+			collect(deleted, ids);
+		}
+		std::sort(ids.begin(), ids.end());
+		ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+		auto result = std::vector<std::string>();
+		for (auto id : ids) {
+			if (is_single_edit(word, words_[id])) {
+				result.push_back(words_[id]);
+			}
+		}
+		return result;
+	}
+
+	auto is_single_edit(std::string_view a, std::string_view b) -> bool {
+		if (a.size() == b.size()) {
+			auto mismatches = 0;
+			for (auto i = std::size_t{0}; i < a.size() && mismatches < 2; ++i) {
+				if (a[i] != b[i]) {
+					++mismatches;
+				}
+			}
+			return mismatches == 1;
+		}
+		if (a.size() > b.size()) {
+			std::swap(a, b);
+		}
+		if (b.size() - a.size() != 1) {
+			return false;
+		}
+		// skip the first mismatch in the longer word, everything after it must line up
+		auto const prefix = static_cast<std::size_t>(
+		   std::mismatch(a.begin(), a.end(), b.begin()).first - a.begin());
+		return a.substr(prefix) == b.substr(prefix + 1);
+	}
+
+	auto generate_extended(std::string const& from,
+	                       std::string const& to,
+	                       deletion_index const& index) -> std::vector<std::vector<std::string>> {
+		if (!index.contains(from) || !index.contains(to)) {
+			return {};
+		}
+		return enumerate_ladders(build_ladder_dag(from, to, [&index](std::string const& word) {
+			return index.neighbours(word);
+		}));
+	}
+
+	auto generate_extended(std::string const& from,
+	                       std::string const& to,
+	                       std::unordered_set<std::string> const& lexicon)
+	   -> std::vector<std::vector<std::string>> {
+		return generate_extended(from, to, deletion_index(lexicon));
+	}
+} // namespace word_ladder
@@ -0,0 +1,271 @@
+#include <comp6771/distance_labels.hpp>
+#include <comp6771/ladder_dag.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace word_ladder {
+	namespace {
+		using id_type = ladder_graph_view::id_type;
+		using label = std::vector<std::pair<std::uint32_t, std::uint16_t>>;
+
+		constexpr auto unreached = std::numeric_limits<std::uint16_t>::max();
+		constexpr auto magic = std::array<char, 8>{'W', 'L', 'P', 'L', 'L', '0', '2', '\n'};
+
+		// pruned bfs from every word of one bucket, in descending degree order. labels holds one
+		// label per word of the bucket, indexed by id - first.
+		auto label_bucket(ladder_graph_view graph, id_type first, id_type last, label* labels)
+		   -> void {
+			auto const size = static_cast<std::size_t>(last - first);
+			auto order = std::vector<id_type>(size);
+			for (auto i = std::size_t{0}; i < size; ++i) {
+				order[i] = first + static_cast<id_type>(i);
+			}
+			std::stable_sort(order.begin(), order.end(), [&](id_type a, id_type b) {
+				return graph.neighbours(a).size() > graph.neighbours(b).size();
+			});
+
+			// root_label[hub] is the root's distance to hub, so pruning costs one pass over the
+			// visited word's label
+			auto root_label = std::vector<std::uint16_t>(size, unreached);
+			auto visited = std::vector<std::uint16_t>(size, unreached);
+			auto queue = std::vector<id_type>();
+			for (auto rank = std::uint32_t{0}; rank < size; ++rank) {
+				auto const root = order[rank];
+				for (auto const& [hub, distance] : labels[root - first]) {
+					root_label[hub] = distance;
+				}
+				queue.assign(1, root);
+				visited[root - first] = 0;
+				for (auto i = std::size_t{0}; i < queue.size(); ++i) {
+					auto const word = queue[i];
+					auto const depth = visited[word - first];
+					auto known = static_cast<int>(unreached);
+					for (auto const& [hub, distance] : labels[word - first]) {
+						if (root_label[hub] != unreached) {
+							known = std::min(known, root_label[hub] + distance);
+						}
+					}
+					if (known <= depth) {
+						continue;
+					}
+					labels[word - first].emplace_back(rank, depth);
+					for (auto neighbour : graph.neighbours(word)) {
+						if (visited[neighbour - first] == unreached) {
+							visited[neighbour - first] = static_cast<std::uint16_t>(depth + 1);
+							queue.push_back(neighbour);
+						}
+					}
+				}
+				for (auto word : queue) {
+					visited[word - first] = unreached;
+				}
+				for (auto const& [hub, distance] : labels[root - first]) {
+					root_label[hub] = unreached;
+				}
+			}
+		}
+
+		// fnv-1a over every word in id order and its neighbour ids. labels hold ids, so they only
+		// fit the graph they were built on: the same lexicon numbered another way (graph_order), or
+		// another lexicon with the same counts, gives a different fingerprint.
+		auto fingerprint(ladder_graph_view graph) -> std::uint64_t {
+			auto hash = std::uint64_t{0xcbf29ce484222325};
+			auto const mix = [&hash](std::uint64_t value, std::size_t bytes) {
+				for (auto i = std::size_t{0}; i < bytes; ++i) {
+					hash = (hash ^ ((value >> (8 * i)) & 0xFFU)) * 0x100000001b3;
+				}
+			};
+			for (auto id = id_type{0}; id < graph.size(); ++id) {
+				auto const word = graph.word(id);
+				mix(word.size(), sizeof(std::uint32_t));
+				for (auto letter : word) {
+					mix(static_cast<unsigned char>(letter), 1);
+				}
+				auto const neighbours = graph.neighbours(id);
+				mix(neighbours.size(), sizeof(std::uint32_t));
+				for (auto neighbour : neighbours) {
+					mix(neighbour, sizeof(id_type));
+				}
+			}
+			return hash;
+		}
+
+		template<typename T>
+		auto write_array(std::ofstream& out, std::vector<T> const& values) -> void {
+			out.write(reinterpret_cast<char const*>(values.data()),
+			          static_cast<std::streamsize>(values.size() * sizeof(T)));
+		}
+
+		template<typename T>
+		auto read_array(std::ifstream& in, std::vector<T>& values, std::uint64_t count) -> void {
+			values.resize(count);
+			in.read(reinterpret_cast<char*>(values.data()),
+			        static_cast<std::streamsize>(values.size() * sizeof(T)));
+		}
+	} // namespace
+
+	distance_labels::distance_labels(ladder_graph_view graph, unsigned threads)
+	: graph_(graph) {
+		// largest buckets first, so the slowest ones do not start last
+		auto buckets = std::vector<std::pair<id_type, id_type>>();
+		for (auto length = std::size_t{0}; length <= graph.max_length(); ++length) {
+			auto const range = graph.bucket(length);
+			if (range.first != range.second) {
+				buckets.push_back(range);
+			}
+		}
+		std::sort(buckets.begin(), buckets.end(), [](auto const& a, auto const& b) {
+			return a.second - a.first > b.second - b.first;
+		});
+
+		auto labels = std::vector<label>(graph.size());
+		auto next = std::atomic<std::size_t>{0};
+		auto const worker = [&] {
+			for (auto i = next.fetch_add(1); i < buckets.size(); i = next.fetch_add(1)) {
+				label_bucket(graph, buckets[i].first, buckets[i].second, labels.data() + buckets[i].first);
+			}
+		};
+		if (threads == 0) {
+			threads = std::max(1U, std::thread::hardware_concurrency());
+		}
+		{
+			auto pool = std::vector<std::jthread>();
+			for (auto i = 1U; i < std::min<std::size_t>(threads, buckets.size()); ++i) {
+				pool.emplace_back(worker);
+			}
+			worker();
+		}
+
+		label_offsets_.reserve(labels.size() + 1);
+		label_offsets_.push_back(0);
+		for (auto const& word_label : labels) {
+			for (auto const& [hub, distance] : word_label) {
+				hubs_.push_back(hub);
+				distances_.push_back(distance);
+			}
+			label_offsets_.push_back(hubs_.size());
+		}
+	}
+
+	// file layout: magic, word count, edge count, entry count, graph fingerprint (all uint64), then
+	// the label offsets, hubs and distances arrays in native byte order
+	auto distance_labels::save(std::string const& path) const -> void {
+		auto out = std::ofstream(path, std::ios::binary);
+		if (not out) {
+			throw std::runtime_error("Unable to open file.");
+		}
+		auto const header = std::array<std::uint64_t, 4>{graph_.size(),
+		                                                 graph_.edge_count(),
+		                                                 hubs_.size(),
+		                                                 fingerprint(graph_)};
+		out.write(magic.data(), magic.size());
+		out.write(reinterpret_cast<char const*>(header.data()), sizeof(header));
+		write_array(out, label_offsets_);
+		write_array(out, hubs_);
+		write_array(out, distances_);
+		if (not out) {
+			throw std::runtime_error("I/O error while writing");
+		}
+	}
+
+	auto distance_labels::load(std::string const& path, ladder_graph_view graph) -> distance_labels {
+		auto in = std::ifstream(path, std::ios::binary);
+		if (not in) {
+			throw std::runtime_error("Unable to open file.");
+		}
+		auto file_magic = std::array<char, 8>();
+		auto header = std::array<std::uint64_t, 4>();
+		in.read(file_magic.data(), file_magic.size());
+		in.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+		if (not in || file_magic != magic) {
+			throw std::runtime_error("Not a distance label file.");
+		}
+		if (header[0] != graph.size() || header[1] != graph.edge_count()
+		    || header[3] != fingerprint(graph)) {
+			throw std::runtime_error("Distance labels were built for a different graph.");
+		}
+		// the rest of the file has to be exactly the three arrays, which is checked before the entry
+		// count is trusted with an allocation
+		auto const arrays_begin = in.tellg();
+		in.seekg(0, std::ios::end);
+		auto const arrays_bytes = static_cast<std::uint64_t>(in.tellg() - arrays_begin);
+		in.seekg(arrays_begin);
+		auto const offsets_bytes = (header[0] + 1) * sizeof(std::uint64_t);
+		constexpr auto entry_bytes = sizeof(std::uint32_t) + sizeof(std::uint16_t);
+		if (arrays_bytes < offsets_bytes || (arrays_bytes - offsets_bytes) % entry_bytes != 0
+		    || (arrays_bytes - offsets_bytes) / entry_bytes != header[2]) {
+			throw std::runtime_error("Not a distance label file.");
+		}
+		auto labels = distance_labels(graph, unlabelled{});
+		read_array(in, labels.label_offsets_, header[0] + 1);
+		read_array(in, labels.hubs_, header[2]);
+		read_array(in, labels.distances_, header[2]);
+		if (not in) {
+			throw std::runtime_error("I/O error while reading");
+		}
+		// distance() indexes hubs_ and distances_ with the offsets unchecked
+		auto const& offsets = labels.label_offsets_;
+		if (offsets.front() != 0 || not std::is_sorted(offsets.begin(), offsets.end())
+		    || offsets.back() != header[2] || in.peek() != std::ifstream::traits_type::eof()) {
+			throw std::runtime_error("Not a distance label file.");
+		}
+		return labels;
+	}
+
+	auto distance_labels::distance(id_type from, id_type to) const -> std::optional<int> {
+		if (from == ladder_graph_view::npos || to == ladder_graph_view::npos) {
+			return std::nullopt;
+		}
+		if (from == to) {
+			return 0;
+		}
+		// hubs are ranks within a bucket, so they only mean the same word within one length
+		if (graph_.word(from).size() != graph_.word(to).size()) {
+			return std::nullopt;
+		}
+		auto i = label_offsets_[from];
+		auto j = label_offsets_[to];
+		auto const i_end = label_offsets_[from + 1];
+		auto const j_end = label_offsets_[to + 1];
+		auto best = std::optional<int>();
+		while (i < i_end && j < j_end) {
+			if (hubs_[i] < hubs_[j]) {
+				++i;
+			}
+			else if (hubs_[j] < hubs_[i]) {
+				++j;
+			}
+			else {
+				auto const through_hub = distances_[i] + distances_[j];
+				best = best ? std::min(*best, through_hub) : through_hub;
+				++i;
+				++j;
+			}
+		}
+		return best;
+	}
+
+	auto distance_labels::distance(std::string_view from, std::string_view to) const
+	   -> std::optional<int> {
+		return distance(graph_.find(from), graph_.find(to));
+	}
+
+	auto distance_labels::ladders(std::string const& from, std::string const& to) const
+	   -> std::vector<std::vector<std::string>> {
+		if (!distance(from, to)) {
+			return {};
+		}
+		return generate(from, to, graph_);
+	}
+
+	auto distance_labels::label_entries() const -> std::size_t {
+		return hubs_.size();
+	}
+} // namespace word_ladder
@@ -0,0 +1,315 @@
+#include <comp6771/front_coded_lexicon.hpp>
+#include <comp6771/ladder_dag.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace word_ladder {
+	namespace {
+		// words read_front_coded_lexicon holds as strings at a time
+		constexpr auto run_words = std::size_t{1} << 16U;
+
+		// below this many fixed leading letters, match probes each alphabet letter at the wildcard;
+		// from here on the words sharing the prefix are few enough to scan directly
+		constexpr auto scan_prefix_length = std::size_t{3};
+
+		auto put_varint(std::string& out, std::size_t value) -> void {
+			while (value >= 0x80) {
+				out.push_back(static_cast<char>((value & 0x7FU) | 0x80U));
+				value >>= 7U;
+			}
+			out.push_back(static_cast<char>(value));
+		}
+
+		auto get_varint(char const*& cursor) -> std::size_t {
+			auto value = std::size_t{0};
+			auto shift = 0U;
+			auto byte = std::uint8_t{0};
+			do {
+				byte = static_cast<std::uint8_t>(*cursor++);
+				value |= static_cast<std::size_t>(byte & 0x7FU) << shift;
+				shift += 7;
+			} while ((byte & 0x80U) != 0);
+			return value;
+		}
+
+		// decodes the words of consecutive blocks one at a time, reusing a single buffer
+		class block_reader {
+		public:
+			block_reader(char const* cursor, char const* end)
+			: cursor_(cursor)
+			, end_(end) {}
+
+			auto next() -> bool {
+				if (cursor_ == end_) {
+					return false;
+				}
+				auto const shared = get_varint(cursor_);
+				auto const suffix = get_varint(cursor_);
+				word_.resize(shared);
+				word_.append(cursor_, suffix);
+				cursor_ += suffix;
+				return true;
+			}
+
+			[[nodiscard]] auto word() const -> std::string_view {
+				return word_;
+			}
+
+		private:
+			char const* cursor_;
+			char const* end_;
+			std::string word_;
+		};
+	} // namespace
+
+	class front_coded_lexicon::encoder {
+	public:
+		// a word equal to the last one is skipped, so sorted input may hold duplicates
+		auto add(std::string_view word) -> void {
+			auto shared = std::size_t{0};
+			if (lexicon_.size_ > 0) {
+				if (word == previous_) {
+					return;
+				}
+				shared = static_cast<std::size_t>(
+				   std::mismatch(word.begin(), word.end(), previous_.begin(), previous_.end()).first
+				   - word.begin());
+			}
+			if (lexicon_.size_ % block_size == 0) {
+				if (lexicon_.data_.size() > std::numeric_limits<std::uint32_t>::max()) {
+					throw std::length_error("front_coded_lexicon is limited to 4 GiB of words");
+				}
+				lexicon_.block_offsets_.push_back(static_cast<std::uint32_t>(lexicon_.data_.size()));
+				shared = 0;
+			}
+			put_varint(lexicon_.data_, shared);
+			put_varint(lexicon_.data_, word.size() - shared);
+			lexicon_.data_.append(word.substr(shared));
+			for (auto letter : word) {
+				used_[static_cast<unsigned char>(letter)] = true;
+			}
+			previous_ = word;
+			++lexicon_.size_;
+		}
+
+		auto finish() && -> front_coded_lexicon {
+			lexicon_.data_.shrink_to_fit();
+			lexicon_.block_offsets_.shrink_to_fit();
+			for (auto letter = std::size_t{0}; letter < used_.size(); ++letter) {
+				if (used_[letter]) {
+					lexicon_.alphabet_.push_back(static_cast<char>(letter));
+				}
+			}
+			return std::move(lexicon_);
+		}
+
+	private:
+		front_coded_lexicon lexicon_;
+		std::string previous_;
+		std::array<bool, 256> used_ = {};
+	};
+
+	front_coded_lexicon::front_coded_lexicon(std::vector<std::string> words) {
+		std::sort(words.begin(), words.end());
+		auto encoded = encoder();
+		for (auto const& word : words) {
+			encoded.add(word);
+		}
+		*this = std::move(encoded).finish();
+	}
+
+	front_coded_lexicon::front_coded_lexicon(std::unordered_set<std::string> const& lexicon)
+	: front_coded_lexicon(std::vector<std::string>(lexicon.begin(), lexicon.end())) {}
+
+	auto front_coded_lexicon::block_head(std::size_t block) const -> std::string_view {
+		auto const* cursor = data_.data() + block_offsets_[block];
+		get_varint(cursor);
+		auto const length = get_varint(cursor);
+		return {cursor, length};
+	}
+
+	auto front_coded_lexicon::block_words(std::size_t block) const -> std::size_t {
+		return std::min(block_size, size_ - block * block_size);
+	}
+
+	auto front_coded_lexicon::contains(std::string_view word) const -> bool {
+		// the last block whose head is not greater than word is the only one that can hold it
+		auto const blocks = block_offsets_.size();
+		auto first = std::size_t{0};
+		auto count = blocks;
+		while (count > 0) {
+			auto const step = count / 2;
+			if (block_head(first + step) <= word) {
+				first += step + 1;
+				count -= step + 1;
+			}
+			else {
+				count = step;
+			}
+		}
+		if (first == 0) {
+			return false;
+		}
+		auto const block = first - 1;
+		auto const* begin = data_.data() + block_offsets_[block];
+		auto const* end = block + 1 < blocks ? data_.data() + block_offsets_[block + 1]
+		                                     : data_.data() + data_.size();
+		auto reader = block_reader(begin, end);
+		for (auto i = std::size_t{0}; i < block_words(block) && reader.next(); ++i) {
+			if (reader.word() == word) {
+				return true;
+			}
+			if (reader.word() > word) {
+				return false;
+			}
+		}
+		return false;
+	}
+
+	auto front_coded_lexicon::size() const -> std::size_t {
+		return size_;
+	}
+
+	auto front_coded_lexicon::memory_usage() const -> std::size_t {
+		return data_.capacity() + block_offsets_.capacity() * sizeof(std::uint32_t)
+		       + alphabet_.capacity();
+	}
+
+	auto front_coded_lexicon::match(std::string_view pattern, std::size_t wildcard) const
+	   -> std::vector<std::string> {
+		auto result = std::vector<std::string>();
+		if (wildcard >= pattern.size() || size_ == 0) {
+			return result;
+		}
+
+		if (wildcard < scan_prefix_length) {
+			auto candidate = std::string(pattern);
+			for (auto letter : alphabet_) {
+				candidate[wildcard] = letter;
+				if (contains(candidate)) {
+					result.push_back(candidate);
+				}
+			}
+			return result;
+		}
+
+		// scan forward from the block that would hold the prefix while words still start with it
+		auto const prefix = pattern.substr(0, wildcard);
+		auto const suffix = pattern.substr(wildcard + 1);
+		auto first = std::size_t{0};
+		auto count = block_offsets_.size();
+		while (count > 0) {
+			auto const step = count / 2;
+			if (block_head(first + step) < prefix) {
+				first += step + 1;
+				count -= step + 1;
+			}
+			else {
+				count = step;
+			}
+		}
+		auto const block = first == 0 ? 0 : first - 1;
+		auto reader = block_reader(data_.data() + block_offsets_[block], data_.data() + data_.size());
+		while (reader.next()) {
+			auto const word = reader.word();
+			if (word < prefix) {
+				continue;
+			}
+			if (!word.starts_with(prefix)) {
+				break;
+			}
+			if (word.size() == pattern.size() && word.substr(wildcard + 1) == suffix) {
+				result.emplace_back(word);
+			}
+		}
+		return result;
+	}
+
+	auto front_coded_lexicon::words() const -> std::vector<std::string> {
+		auto result = std::vector<std::string>();
+		result.reserve(size_);
+		auto reader = block_reader(data_.data(), data_.data() + data_.size());
+		while (reader.next()) {
+			result.emplace_back(reader.word());
+		}
+		return result;
+	}
+
+	auto front_coded_lexicon::merge(std::vector<front_coded_lexicon> const& lexicons)
+	   -> front_coded_lexicon {
+		auto readers = std::vector<block_reader>();
+		readers.reserve(lexicons.size());
+		for (auto const& lexicon : lexicons) {
+			readers.emplace_back(lexicon.data_.data(), lexicon.data_.data() + lexicon.data_.size());
+		}
+		// the reader with the smallest current word on top
+		auto const later = [&readers](std::size_t first, std::size_t second) {
+			return readers[first].word() > readers[second].word();
+		};
+		auto next = std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(later)>(later);
+		for (auto i = std::size_t{0}; i < readers.size(); ++i) {
+			if (readers[i].next()) {
+				next.push(i);
+			}
+		}
+		auto encoded = encoder();
+		while (not next.empty()) {
+			auto const smallest = next.top();
+			next.pop();
+			encoded.add(readers[smallest].word());
+			if (readers[smallest].next()) {
+				next.push(smallest);
+			}
+		}
+		return std::move(encoded).finish();
+	}
+
+	auto read_front_coded_lexicon(std::string const& path) -> front_coded_lexicon {
+		auto in = std::ifstream(path.data());
+		if (not in) {
+			throw std::runtime_error("Unable to open file.");
+		}
+		auto runs = std::vector<front_coded_lexicon>();
+		auto words = std::vector<std::string>();
+		auto word = std::string();
+		while (in >> word) {
+			words.push_back(std::move(word));
+			if (words.size() == run_words) {
+				runs.emplace_back(std::move(words));
+				words.clear();
+			}
+		}
+		if (in.bad()) {
+			throw std::runtime_error("I/O error while reading");
+		}
+		if (not words.empty() or runs.empty()) {
+			runs.emplace_back(std::move(words));
+		}
+		if (runs.size() == 1) {
+			return std::move(runs.front());
+		}
+		return front_coded_lexicon::merge(runs);
+	}
+
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              front_coded_lexicon const& lexicon) -> std::vector<std::vector<std::string>> {
+		return enumerate_ladders(build_ladder_dag(from, to, [&lexicon](std::string const& word) {
+			auto neighbours = std::vector<std::string>();
+			for (auto i = std::size_t{0}; i < word.size(); ++i) {
+				for (auto& match : lexicon.match(word, i)) {
+					if (match != word) {
+						neighbours.push_back(std::move(match));
+					}
+				}
+			}
+			return neighbours;
+		}));
+	}
+} // namespace word_ladder
@@ -0,0 +1,237 @@
+#include <comp6771/command_line.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// compares the graph_order numberings on the largest length buckets of a lexicon. for every order
+// the graph is rebuilt, and a full bfs is run from evenly spaced sources of each bucket while the
+// hardware counters for l1 data cache read misses and last level cache misses are read through
+// perf_event_open. where the counters are not available (no pmu, or perf_event_paranoid too high)
+// only the wall time is reported. the mean id gap along edges is printed as a hardware independent
+// measure of locality.
+//
+// usage: graph_order_benchmark --lexicon path [--buckets n] [--sources n]
+
+namespace {
+	using id_type = word_ladder::ladder_graph_view::id_type;
+
+	// one hardware counter, counting user space only. an unavailable counter reads as nullopt.
+	class perf_counter {
+	public:
+		perf_counter(std::uint32_t type, std::uint64_t config) {
+			auto attributes = perf_event_attr();
+			std::memset(&attributes, 0, sizeof(attributes));
+			attributes.size = sizeof(attributes);
+			attributes.type = type;
+			attributes.config = config;
+			attributes.disabled = 1;
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+		}
+		perf_counter(perf_counter const&) = delete;
+		auto operator=(perf_counter const&) -> perf_counter& = delete;
+		~perf_counter() {
+			if (fd_ >= 0) {
+				::close(fd_);
+			}
+		}
+
+		auto start() -> void {
+			if (fd_ >= 0) {
+				::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+				::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+			}
+		}
+
+		auto stop() -> std::optional<std::uint64_t> {
+			auto count = std::uint64_t{0};
+			if (fd_ < 0) {
+				return std::nullopt;
+			}
+			::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+			if (::read(fd_, &count, sizeof(count)) != sizeof(count)) {
+				return std::nullopt;
+			}
+			return count;
+		}
+
+	private:
+		int fd_ = -1;
+	};
+
+	struct measurement {
+		double milliseconds = 0;
+		std::optional<std::uint64_t> l1_misses;
+		std::optional<std::uint64_t> llc_misses;
+		double mean_gap = 0;
+		std::size_t visits = 0;
+	};
+
+	// bfs over one bucket from each source, with the visited marks and the queue indexed by id, as
+	// every search over the graph does
+	auto search(word_ladder::ladder_graph_view graph,
+	            id_type first,
+	            id_type last,
+	            std::vector<id_type> const& sources) -> std::size_t {
+		auto const size = static_cast<std::size_t>(last - first);
+		auto visited = std::vector<std::uint32_t>(size, 0);
+		auto queue = std::vector<id_type>();
+		queue.reserve(size);
+		auto reached = std::size_t{0};
+		for (auto s = std::size_t{0}; s < sources.size(); ++s) {
+			auto const stamp = static_cast<std::uint32_t>(s + 1);
+			auto const source = sources[s];
+			queue.assign(1, source);
+			visited[source - first] = stamp;
+			for (auto i = std::size_t{0}; i < queue.size(); ++i) {
+				for (auto neighbour : graph.neighbours(queue[i])) {
+					if (visited[neighbour - first] != stamp) {
+						visited[neighbour - first] = stamp;
+						queue.push_back(neighbour);
+					}
+				}
+			}
+			reached += queue.size();
+		}
+		return reached;
+	}
+
+	auto measure(word_ladder::ladder_graph_view graph,
+	             std::pair<id_type, id_type> bucket,
+	             std::size_t source_count) -> measurement {
+		auto result = measurement();
+		auto gaps = 0.0;
+		auto edges = std::size_t{0};
+		for (auto id = bucket.first; id < bucket.second; ++id) {
+			for (auto neighbour : graph.neighbours(id)) {
+				gaps += neighbour > id ? neighbour - id : id - neighbour;
+				++edges;
+			}
+		}
+		result.mean_gap = edges > 0 ? gaps / static_cast<double>(edges) : 0.0;
+
+		// the same source words under every order, evenly spaced in spelling order
+		auto words = std::vector<std::string_view>();
+		for (auto id = bucket.first; id < bucket.second; ++id) {
+			words.push_back(graph.word(id));
+		}
+		std::sort(words.begin(), words.end());
+		auto sources = std::vector<id_type>();
+		for (auto s = std::size_t{0}; s < source_count; ++s) {
+			sources.push_back(graph.find(words[s * words.size() / source_count]));
+		}
+		// one untimed run, so every order starts with the same warm caches
+		search(graph, bucket.first, bucket.second, sources);
+
+		auto l1 = perf_counter(PERF_TYPE_HW_CACHE,
+		                       PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+		                          | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+		auto llc = perf_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+		auto const start = std::chrono::steady_clock::now();
+		l1.start();
+		llc.start();
+		result.visits = search(graph, bucket.first, bucket.second, sources);
+		result.llc_misses = llc.stop();
+		result.l1_misses = l1.stop();
+		result.milliseconds =
+		   std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return result;
+	}
+
+	auto print_count(std::optional<std::uint64_t> count) -> std::string {
+		return count ? std::to_string(*count) : std::string("n/a");
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	auto lexicon_path = std::string();
+	auto bucket_count = std::size_t{3};
+	auto sources = std::size_t{64};
+	auto const args = std::vector<std::string>(argv + 1, argv + argc);
+	for (auto i = std::size_t{0}; i < args.size(); ++i) {
+		auto const has_value = i + 1 < args.size();
+		if (args[i] == "--lexicon" && has_value) {
+			lexicon_path = args[++i];
+		}
+		else if ((args[i] == "--buckets" || args[i] == "--sources") && has_value) {
+			auto const count =
+			   word_ladder::parse_count("graph_order_benchmark", args[i], args[i + 1]);
+			if (!count) {
+				lexicon_path.clear();
+				break;
+			}
+			auto& option = args[i] == "--buckets" ? bucket_count : sources;
+			option = static_cast<std::size_t>(std::max(std::uint64_t{1}, *count));
+			++i;
+		}
+		else {
+			lexicon_path.clear();
+			break;
+		}
+	}
+	if (lexicon_path.empty()) {
+		std::cerr << "usage: graph_order_benchmark --lexicon path [--buckets n] [--sources n]\n";
+		return 2;
+	}
+
+	auto lexicon = std::unordered_set<std::string>();
+	try {
+		lexicon = word_ladder::read_lexicon(lexicon_path);
+	} catch (std::exception const& e) {
+		std::cerr << "graph_order_benchmark: " << lexicon_path << ": " << e.what() << "\n";
+		return 1;
+	}
+
+	constexpr auto orders = std::array{
+	   std::pair{word_ladder::graph_order::alphabetical, "alphabetical"},
+	   std::pair{word_ladder::graph_order::bfs, "bfs"},
+	   std::pair{word_ladder::graph_order::reverse_cuthill_mckee, "reverse_cuthill_mckee"},
+	   std::pair{word_ladder::graph_order::degree, "degree"}};
+	std::cout << std::left << std::setw(8) << "length" << std::setw(24) << "order" << std::setw(12)
+	          << "mean gap" << std::setw(12) << "visits" << std::setw(12) << "ms" << std::setw(16)
+	          << "l1d misses" << "llc misses\n";
+	for (auto const& [order, name] : orders) {
+		auto const owner = word_ladder::ladder_graph(lexicon, order);
+		auto const graph = owner.view();
+		// lengths no word has (common in small lexicons) have no sources to search from
+		auto lengths = std::vector<std::size_t>();
+		for (auto length = std::size_t{1}; length <= graph.max_length(); ++length) {
+			if (graph.bucket(length).first != graph.bucket(length).second) {
+				lengths.push_back(length);
+			}
+		}
+		std::stable_sort(lengths.begin(), lengths.end(), [&](auto a, auto b) {
+			return graph.bucket(a).second - graph.bucket(a).first
+			       > graph.bucket(b).second - graph.bucket(b).first;
+		});
+		lengths.resize(std::min(lengths.size(), bucket_count));
+		std::sort(lengths.begin(), lengths.end());
+		for (auto length : lengths) {
+			auto const result = measure(graph, graph.bucket(length), sources);
+			std::cout << std::setw(8) << length << std::setw(24) << name << std::setw(12)
+			          << std::fixed << std::setprecision(1) << result.mean_gap << std::setw(12)
+			          << result.visits << std::setw(12) << std::setprecision(2) << result.milliseconds
+			          << std::setw(16)
+			          << print_count(result.l1_misses) << print_count(result.llc_misses) << "\n";
+		}
+	}
+}
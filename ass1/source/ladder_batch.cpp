@@ -0,0 +1,363 @@
+#include <comp6771/command_line.hpp>
+#include <comp6771/deletion_index.hpp>
+#include <comp6771/ladder_cache.hpp>
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/mapped_ladder_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// batch driver for bulk ladder jobs. the lexicon is loaded once, queries ("from to" per line, blank
+// lines and lines starting with '#' are skipped) are read from stdin or --input in batches, each
+// batch is spread over --threads workers, and results are written to stdout in input order:
+//
+//     > from to <number of ladders>
+//     from ... to
+//     ...
+//
+// with --cache n, up to n shortest path dags are kept in a ladder_cache shared by the workers, so
+// repeated and mirrored queries are not recomputed. a throughput and latency summary is printed to
+// stderr on exit.
+//
+// several worker processes on one host can share a single copy of the ladder graph: build it once
+// with --write-index (e.g. under /dev/shm), then start each worker with --index instead of
+// --lexicon. workers map the file read only, so attaching is immediate and costs no private memory.
+//
+// usage: ladder_batch --lexicon path [--input path] [--threads n] [--batch n] [--cache n]
+//                     [--extended]
+//        ladder_batch --lexicon path --write-index path
+//                     [--order alphabetical|bfs|reverse_cuthill_mckee|degree]
+//        ladder_batch --index path [--input path] [--threads n] [--batch n] [--cache n]
+
+namespace {
+	struct options {
+		std::string lexicon_path;
+		std::string index_path;
+		std::string write_index_path;
+		word_ladder::graph_order order = word_ladder::graph_order::reverse_cuthill_mckee;
+		std::optional<std::string> input_path;
+		unsigned threads = std::max(1U, std::thread::hardware_concurrency());
+		std::size_t batch_size = 1024;
+		std::size_t cache_capacity = 0;
+		bool extended = false;
+	};
+
+	struct query {
+		std::string from;
+		std::string to;
+	};
+
+	// per query output slot. slots are reused across batches and only ever cleared, so once their
+	// buffers have grown to fit the largest result, formatting no longer allocates.
+	struct result_slot {
+		std::string text;
+		std::uint64_t latency_ns = 0;
+		std::size_t ladders = 0;
+		bool rejected = false;
+	};
+
+	auto usage() -> void {
+		std::cerr << "usage: ladder_batch --lexicon path [--input path] [--threads n] [--batch n] "
+		             "[--cache n] [--extended]\n"
+		             "       ladder_batch --lexicon path --write-index path "
+		             "[--order alphabetical|bfs|reverse_cuthill_mckee|degree]\n"
+		             "       ladder_batch --index path [--input path] [--threads n] [--batch n] "
+		             "[--cache n]\n";
+	}
+
+	auto parse_options(int argc, char** argv) -> std::optional<options> {
+		auto opts = options();
+		auto const args = std::vector<std::string>(argv + 1, argv + argc);
+		for (auto i = std::size_t{0}; i < args.size(); ++i) {
+			auto const has_value = i + 1 < args.size();
+			if (args[i] == "--lexicon" && has_value) {
+				opts.lexicon_path = args[++i];
+			}
+			else if (args[i] == "--index" && has_value) {
+				opts.index_path = args[++i];
+			}
+			else if (args[i] == "--write-index" && has_value) {
+				opts.write_index_path = args[++i];
+			}
+			else if (args[i] == "--order" && has_value) {
+				auto const name = args[++i];
+				if (name == "alphabetical") {
+					opts.order = word_ladder::graph_order::alphabetical;
+				}
+				else if (name == "bfs") {
+					opts.order = word_ladder::graph_order::bfs;
+				}
+				else if (name == "reverse_cuthill_mckee") {
+					opts.order = word_ladder::graph_order::reverse_cuthill_mckee;
+				}
+				else if (name == "degree") {
+					opts.order = word_ladder::graph_order::degree;
+				}
+				else {
+					return std::nullopt;
+				}
+			}
+			else if (args[i] == "--input" && has_value) {
+				opts.input_path = args[++i];
+			}
+			else if (args[i] == "--threads" || args[i] == "--batch" || args[i] == "--cache") {
+				auto const count = has_value
+				                      ? word_ladder::parse_count("ladder_batch", args[i], args[i + 1])
+				                      : std::nullopt;
+				if (!count) {
+					return std::nullopt;
+				}
+				if (args[i] == "--threads") {
+					auto const most = std::uint64_t{std::numeric_limits<unsigned>::max()};
+					opts.threads = static_cast<unsigned>(std::clamp(*count, std::uint64_t{1}, most));
+				}
+				else if (args[i] == "--batch") {
+					opts.batch_size = static_cast<std::size_t>(std::max(std::uint64_t{1}, *count));
+				}
+				else {
+					opts.cache_capacity = static_cast<std::size_t>(*count);
+				}
+				++i;
+			}
+			else if (args[i] == "--extended") {
+				opts.extended = true;
+			}
+			else {
+				return std::nullopt;
+			}
+		}
+		// exactly one source of words, and the mapped graph only holds single letter substitutions
+		if (opts.lexicon_path.empty() == opts.index_path.empty()
+		    || (!opts.write_index_path.empty() && opts.lexicon_path.empty())
+		    || (!opts.index_path.empty() && opts.extended))
+		{
+			return std::nullopt;
+		}
+		return opts;
+	}
+
+	// reads up to batch_size queries into batch, returns false once the input is exhausted
+	auto read_batch(std::istream& in, std::size_t batch_size, std::vector<query>& batch) -> bool {
+		batch.clear();
+		auto line = std::string();
+		while (batch.size() < batch_size && std::getline(in, line)) {
+			auto words = std::istringstream(line);
+			auto q = query();
+			if (!(words >> q.from) || q.from.front() == '#') {
+				continue;
+			}
+			if (!(words >> q.to)) {
+				std::cerr << "ladder_batch: skipping malformed query \"" << line << "\"\n";
+				continue;
+			}
+			batch.push_back(std::move(q));
+		}
+		return !batch.empty();
+	}
+
+	auto format(query const& q,
+	            std::vector<std::vector<std::string>> const& ladders,
+	            std::string& out) -> void {
+		out.clear();
+		out.append("> ").append(q.from).append(" ").append(q.to).append(" ");
+		out.append(std::to_string(ladders.size())).append("\n");
+		for (auto const& ladder : ladders) {
+			for (auto const& word : ladder) {
+				out.append(word).push_back(' ');
+			}
+			out.back() = '\n';
+		}
+	}
+
+	auto percentile(std::vector<std::uint64_t> const& sorted, double p) -> double {
+		if (sorted.empty()) {
+			return 0;
+		}
+		auto const rank = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+		return static_cast<double>(sorted[rank]) / 1e6;
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	auto const opts = parse_options(argc, argv);
+	if (!opts) {
+		usage();
+		return 2;
+	}
+
+	auto input_file = std::ifstream();
+	if (opts->input_path) {
+		input_file.open(*opts->input_path);
+		if (!input_file) {
+			std::cerr << "ladder_batch: unable to open " << *opts->input_path << "\n";
+			return 1;
+		}
+	}
+	auto& in = opts->input_path ? static_cast<std::istream&>(input_file) : std::cin;
+
+	auto const load_start = std::chrono::steady_clock::now();
+	auto lexicon = std::unordered_set<std::string>();
+	auto mapped = std::optional<word_ladder::mapped_ladder_graph>();
+	try {
+		if (opts->index_path.empty()) {
+			lexicon = word_ladder::read_lexicon(opts->lexicon_path);
+		}
+		else {
+			mapped.emplace(opts->index_path);
+		}
+	} catch (std::exception const& e) {
+		auto const& path = opts->index_path.empty() ? opts->lexicon_path : opts->index_path;
+		std::cerr << "ladder_batch: " << path << ": " << e.what() << "\n";
+		return 1;
+	}
+	if (!opts->write_index_path.empty()) {
+		try {
+			word_ladder::save_ladder_graph(word_ladder::ladder_graph(lexicon, opts->order),
+			                               opts->write_index_path);
+		} catch (std::exception const& e) {
+			std::cerr << "ladder_batch: " << opts->write_index_path << ": " << e.what() << "\n";
+			return 1;
+		}
+		return 0;
+	}
+	auto const graph = mapped ? mapped->view() : word_ladder::ladder_graph_view();
+	auto const word_count = mapped ? graph.size() : lexicon.size();
+	auto const index = opts->extended ? std::make_unique<word_ladder::deletion_index>(lexicon)
+	                                  : std::unique_ptr<word_ladder::deletion_index>();
+	// built once here rather than by every lexicon query
+	auto const alphabet = word_ladder::position_alphabet(lexicon);
+	auto const load_time = std::chrono::steady_clock::now() - load_start;
+	auto const cache = opts->cache_capacity > 0
+	                      ? std::make_unique<word_ladder::ladder_cache>(opts->cache_capacity)
+	                      : std::unique_ptr<word_ladder::ladder_cache>();
+
+	auto const generate = [&](query const& q) {
+		if (cache && mapped) {
+			return cache->generate(q.from, q.to, [&](std::string const& word) {
+				auto neighbours = std::vector<std::string>();
+				for (auto id : graph.neighbours(graph.find(word))) {
+					neighbours.emplace_back(graph.word(id));
+				}
+				return neighbours;
+			});
+		}
+		if (mapped) {
+			return word_ladder::generate(q.from, q.to, graph);
+		}
+		if (cache && index) {
+			return cache->generate(q.from, q.to, [&](std::string const& word) {
+				return index->neighbours(word);
+			});
+		}
+		if (cache) {
+			return cache->generate(q.from, q.to, lexicon, alphabet);
+		}
+		return index ? word_ladder::generate_extended(q.from, q.to, *index)
+		             : word_ladder::generate(q.from, q.to, lexicon, alphabet);
+	};
+
+	auto const run = [&](query const& q, result_slot& slot) {
+		auto const start = std::chrono::steady_clock::now();
+		auto const known = [&](std::string const& word) {
+			return mapped ? graph.find(word) != word_ladder::ladder_graph_view::npos
+			              : lexicon.contains(word);
+		};
+		slot.rejected = !known(q.from) || !known(q.to)
+		                || (!opts->extended && q.from.size() != q.to.size());
+		auto const ladders = slot.rejected ? std::vector<std::vector<std::string>>() : generate(q);
+		format(q, ladders, slot.text);
+		slot.ladders = ladders.size();
+		slot.latency_ns = static_cast<std::uint64_t>(
+		   std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+		      .count());
+	};
+
+	// stdout is written in large blocks only
+	auto stdout_buffer = std::vector<char>(std::size_t{1} << 20);
+	std::setvbuf(stdout, stdout_buffer.data(), _IOFBF, stdout_buffer.size());
+
+	auto batch = std::vector<query>();
+	auto slots = std::vector<result_slot>(opts->batch_size);
+	auto latencies = std::vector<std::uint64_t>();
+	auto total_ladders = std::size_t{0};
+	auto rejected = std::size_t{0};
+	auto const run_start = std::chrono::steady_clock::now();
+	while (read_batch(in, opts->batch_size, batch)) {
+		auto next = std::atomic<std::size_t>{0};
+		// the first exception a query throws (bad_alloc on a huge ladder set, say) stops the other
+		// workers taking more queries, and is rethrown here once they have all stopped
+		auto failure_lock = std::mutex();
+		auto failure = std::exception_ptr();
+		auto const worker = [&] {
+			try {
+				for (auto i = next.fetch_add(1); i < batch.size(); i = next.fetch_add(1)) {
+					run(batch[i], slots[i]);
+				}
+			} catch (...) {
+				auto const lock = std::lock_guard(failure_lock);
+				if (!failure) {
+					failure = std::current_exception();
+				}
+				next.store(batch.size());
+			}
+		};
+		auto const workers = std::min<std::size_t>(opts->threads, batch.size());
+		auto pool = std::vector<std::jthread>();
+		for (auto i = std::size_t{1}; i < workers; ++i) {
+			pool.emplace_back(worker);
+		}
+		worker();
+		pool.clear();
+		if (failure) {
+			std::fflush(stdout);
+			try {
+				std::rethrow_exception(failure);
+			} catch (std::exception const& e) {
+				std::cerr << "ladder_batch: query failed: " << e.what() << "\n";
+			} catch (...) {
+				std::cerr << "ladder_batch: query failed\n";
+			}
+			return 1;
+		}
+
+		for (auto i = std::size_t{0}; i < batch.size(); ++i) {
+			std::fwrite(slots[i].text.data(), 1, slots[i].text.size(), stdout);
+			latencies.push_back(slots[i].latency_ns);
+			total_ladders += slots[i].ladders;
+			rejected += slots[i].rejected ? std::size_t{1} : std::size_t{0};
+		}
+	}
+	std::fflush(stdout);
+	auto const run_seconds =
+	   std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+
+	std::sort(latencies.begin(), latencies.end());
+	std::cerr << (mapped ? "index: " : "lexicon: ") << word_count << " words loaded in "
+	          << std::chrono::duration<double>(load_time).count() << " s\n"
+	          << "queries: " << latencies.size() << " (" << rejected << " rejected), ladders: "
+	          << total_ladders << ", threads: " << opts->threads << "\n"
+	          << "wall: " << run_seconds << " s, throughput: "
+	          << (run_seconds > 0 ? static_cast<double>(latencies.size()) / run_seconds : 0.0)
+	          << " queries/s\n"
+	          << "latency ms: p50 " << percentile(latencies, 0.50) << ", p90 "
+	          << percentile(latencies, 0.90) << ", p99 " << percentile(latencies, 0.99) << ", max "
+	          << percentile(latencies, 1.0) << "\n";
+	if (cache) {
+		std::cerr << "cache: " << cache->hits() << " hits, " << cache->misses() << " misses\n";
+	}
+}
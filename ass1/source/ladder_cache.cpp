@@ -0,0 +1,130 @@
+#include <comp6771/ladder_cache.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+namespace word_ladder {
+	ladder_cache::ladder_cache(std::size_t capacity, std::size_t shards)
+	: capacity_(capacity)
+	, shards_(std::clamp<std::size_t>(capacity, 1, std::max<std::size_t>(1, shards))) {
+		// the first capacity % shards shards take one dag more than the others
+		auto const count = shards_.size();
+		for (auto i = std::size_t{0}; i < count; ++i) {
+			shards_[i].capacity = capacity / count + (i < capacity % count ? std::size_t{1} : 0);
+		}
+	}
+
+	auto ladder_cache::key_hash::operator()(key_type const& key) const -> std::size_t {
+		auto const first = std::hash<std::string_view>{}(key.first);
+		auto const second = std::hash<std::string_view>{}(key.second);
+		return first ^ (second + 0x9e3779b97f4a7c15ULL + (first << 6U) + (first >> 2U));
+	}
+
+	auto ladder_cache::shard_for(key_type const& key) -> shard& {
+		return shards_[key_hash{}(key) % shards_.size()];
+	}
+
+	// looks the key up and marks it as most recently used
+	auto ladder_cache::lookup(key_type const& key) -> std::shared_ptr<ladder_dag const> {
+		auto& s = shard_for(key);
+		auto const lock = std::scoped_lock(s.mutex);
+		auto found = s.entries.find(key);
+		if (found == s.entries.end()) {
+			return nullptr;
+		}
+		s.lru.splice(s.lru.begin(), s.lru, found->second);
+		return found->second->dag;
+	}
+
+	auto ladder_cache::insert(key_type key,
+	                          std::shared_ptr<ladder_dag const> dag,
+	                          std::uint64_t generation) -> void {
+		auto& s = shard_for(key);
+		auto const lock = std::scoped_lock(s.mutex);
+		// invalidate() bumps the generation before clearing the shards, so checking it under the
+		// shard lock is enough to keep stale dags out
+		if (generation != generation_.load() || s.entries.contains(key)) {
+			return;
+		}
+		s.lru.push_front(entry{key, std::move(dag)});
+		s.entries.emplace(std::move(key), s.lru.begin());
+		if (s.lru.size() > s.capacity) {
+			s.entries.erase(s.lru.back().key);
+			s.lru.pop_back();
+		}
+	}
+
+	auto ladder_cache::find(std::string const& from, std::string const& to)
+	   -> std::shared_ptr<ladder_dag const> {
+		if (auto dag = lookup({from, to})) {
+			hits_.fetch_add(1, std::memory_order_relaxed);
+			return dag;
+		}
+		if (auto dag = lookup({to, from})) {
+			hits_.fetch_add(1, std::memory_order_relaxed);
+			return std::make_shared<ladder_dag const>(reverse(*dag));
+		}
+		misses_.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	template<typename Build>
+	auto ladder_cache::generate_with(std::string const& from, std::string const& to, Build build)
+	   -> std::vector<std::vector<std::string>> {
+		if (auto dag = find(from, to)) {
+			return enumerate_ladders(*dag);
+		}
+		auto const generation = generation_.load();
+		auto dag = std::make_shared<ladder_dag const>(build());
+		insert({from, to}, dag, generation);
+		return enumerate_ladders(*dag);
+	}
+
+	auto ladder_cache::generate(std::string const& from,
+	                            std::string const& to,
+	                            std::unordered_set<std::string> const& lexicon,
+	                            position_alphabet const& alphabet)
+	   -> std::vector<std::vector<std::string>> {
+		return generate_with(from, to, [&] {
+			return build_ladder_dag(from, to, lexicon, alphabet);
+		});
+	}
+
+	auto ladder_cache::generate(std::string const& from,
+	                            std::string const& to,
+	                            neighbour_function const& neighbours)
+	   -> std::vector<std::vector<std::string>> {
+		return generate_with(from, to, [&] { return build_ladder_dag(from, to, neighbours); });
+	}
+
+	auto ladder_cache::invalidate() -> void {
+		generation_.fetch_add(1);
+		for (auto& s : shards_) {
+			auto const lock = std::scoped_lock(s.mutex);
+			s.entries.clear();
+			s.lru.clear();
+		}
+	}
+
+	auto ladder_cache::hits() const -> std::uint64_t {
+		return hits_.load(std::memory_order_relaxed);
+	}
+
+	auto ladder_cache::misses() const -> std::uint64_t {
+		return misses_.load(std::memory_order_relaxed);
+	}
+
+	auto ladder_cache::size() const -> std::size_t {
+		auto total = std::size_t{0};
+		for (auto const& s : shards_) {
+			auto const lock = std::scoped_lock(s.mutex);
+			total += s.lru.size();
+		}
+		return total;
+	}
+
+	auto ladder_cache::capacity() const -> std::size_t {
+		return capacity_;
+	}
+} // namespace word_ladder
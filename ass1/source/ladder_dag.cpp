@@ -0,0 +1,348 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/position_alphabet.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+
+namespace word_ladder {
+	auto build_ladder_dag(std::string const& from,
+	                      std::string const& to,
+	                      neighbour_function const& neighbours) -> ladder_dag {
+		// bfs, keeping only the edges that go from one level to the next
+		auto num_hops = std::unordered_map<std::string, int>{{from, 0}};
+		auto next_level = std::unordered_map<std::string, std::vector<std::string>>();
+		auto levels = std::vector<std::vector<std::string>>{{from}};
+		while (!num_hops.contains(to) && !levels.back().empty()) {
+			auto const depth = static_cast<int>(levels.size());
+			auto upcoming = std::vector<std::string>();
+			for (auto const& word : levels.back()) {
+				for (auto& neighbour : neighbours(word)) {
+					auto hops = num_hops.find(neighbour);
+					if (hops == num_hops.end()) {
+						num_hops.emplace(neighbour, depth);
+						upcoming.push_back(neighbour);
+						next_level[word].push_back(std::move(neighbour));
+					}
+					else if (hops->second == depth) {
+						next_level[word].push_back(std::move(neighbour));
+					}
+				}
+			}
+			levels.push_back(std::move(upcoming));
+		}
+		if (!num_hops.contains(to)) {
+			return {};
+		}
+
+		// walk the levels backwards, keeping only edges into words that reach "to"
+		auto reaches_to = std::unordered_set<std::string>{to};
+		auto kept_edges = std::unordered_map<std::string, std::vector<std::string>>();
+		for (auto level = levels.rbegin() + 1; level < levels.rend(); ++level) {
+			for (auto const& word : *level) {
+				auto edges = next_level.find(word);
+				if (edges == next_level.end()) {
+					continue;
+				}
+				auto kept = std::vector<std::string>();
+				std::copy_if(edges->second.begin(),
+				             edges->second.end(),
+				             std::back_inserter(kept),
+				             [&](auto const& neighbour) { return reaches_to.contains(neighbour); });
+				if (!kept.empty()) {
+					reaches_to.insert(word);
+					kept_edges.emplace(word, std::move(kept));
+				}
+			}
+		}
+
+		// renumber the surviving words in sorted order and lay the edges out in csr form
+		auto dag = ladder_dag();
+		dag.words.assign(reaches_to.begin(), reaches_to.end());
+		std::sort(dag.words.begin(), dag.words.end());
+		auto ids = std::unordered_map<std::string, std::uint32_t>();
+		for (auto id = std::uint32_t{0}; id < dag.words.size(); ++id) {
+			ids.emplace(dag.words[id], id);
+		}
+		dag.offsets.reserve(dag.words.size() + 1);
+		dag.offsets.push_back(0);
+		for (auto const& word : dag.words) {
+			auto edges = kept_edges.find(word);
+			if (edges != kept_edges.end()) {
+				auto const first = dag.targets.size();
+				for (auto const& neighbour : edges->second) {
+					dag.targets.push_back(ids.at(neighbour));
+				}
+				std::sort(dag.targets.begin() + static_cast<std::ptrdiff_t>(first), dag.targets.end());
+			}
+			dag.offsets.push_back(static_cast<std::uint32_t>(dag.targets.size()));
+		}
+		dag.source = ids.at(from);
+		dag.target = ids.at(to);
+		return dag;
+	}
+
+	auto build_ladder_dag(std::string const& from,
+	                      std::string const& to,
+	                      std::unordered_set<std::string> const& lexicon) -> ladder_dag {
+		auto never = stop_check();
+		return build_ladder_dag(from, to, lexicon, never);
+	}
+
+	auto build_ladder_dag(std::string const& from,
+	                      std::string const& to,
+	                      std::unordered_set<std::string> const& lexicon,
+	                      position_alphabet const& alphabet) -> ladder_dag {
+		auto never = stop_check();
+		return build_ladder_dag(from, to, lexicon, alphabet, never);
+	}
+
+	auto build_ladder_dag(std::string const& from,
+	                      std::string const& to,
+	                      std::unordered_set<std::string> const& lexicon,
+	                      stop_check& stop) -> ladder_dag {
+		return build_ladder_dag(from, to, lexicon, position_alphabet(lexicon, stop), stop);
+	}
+
+	auto build_ladder_dag(std::string const& from,
+	                      std::string const& to,
+	                      std::unordered_set<std::string> const& lexicon,
+	                      position_alphabet const& alphabet,
+	                      stop_check& stop) -> ladder_dag {
+		return build_ladder_dag(from, to, [&lexicon, &alphabet, &stop](std::string const& word) {
+			stop.poll();
+			auto single_letter_diff_queue = std::deque<std::string>();
+			auto single_letter_diff_map = std::unordered_map<std::string, std::vector<std::string>>();
+			singleLetterDiff(word,
+			                 lexicon,
+			                 alphabet,
+			                 single_letter_diff_queue,
+			                 single_letter_diff_map);
+			return std::move(single_letter_diff_map[word]);
+		});
+	}
+
+	auto build_ladder_dag(std::string const& from, std::string const& to, ladder_graph_view graph)
+	   -> ladder_dag {
+		auto never = stop_check();
+		return build_ladder_dag(from, to, graph, never);
+	}
+
+	// the same level by level bfs, on ids local to the bucket of "from" and "to"
+	auto build_ladder_dag(std::string const& from,
+	                      std::string const& to,
+	                      ladder_graph_view graph,
+	                      stop_check& stop) -> ladder_dag {
+		using id_type = ladder_graph_view::id_type;
+		auto const source = graph.find(from);
+		auto const target = graph.find(to);
+		if (source == ladder_graph_view::npos || target == ladder_graph_view::npos
+		    || from.size() != to.size())
+		{
+			return {};
+		}
+		auto const first = graph.bucket(from.size()).first;
+		auto const size = graph.bucket(from.size()).second - first;
+		constexpr auto unreached = std::numeric_limits<std::uint32_t>::max();
+		auto depth = std::vector<std::uint32_t>(size, unreached);
+		auto levels = std::vector<std::vector<id_type>>{{source}};
+		depth[source - first] = 0;
+		while (depth[target - first] == unreached && !levels.back().empty()) {
+			auto upcoming = std::vector<id_type>();
+			for (auto word : levels.back()) {
+				stop.poll();
+				for (auto neighbour : graph.neighbours(word)) {
+					if (depth[neighbour - first] == unreached) {
+						depth[neighbour - first] = static_cast<std::uint32_t>(levels.size());
+						upcoming.push_back(neighbour);
+					}
+				}
+			}
+			levels.push_back(std::move(upcoming));
+		}
+		if (depth[target - first] == unreached) {
+			return {};
+		}
+
+		// a word is kept if some neighbour one level further on is kept
+		auto kept = std::vector<bool>(size, false);
+		auto survivors = std::vector<id_type>{target};
+		kept[target - first] = true;
+		for (auto level = levels.size() - 1; level-- > 0;) {
+			for (auto word : levels[level]) {
+				auto const next = depth[word - first] + 1;
+				auto const neighbours = graph.neighbours(word);
+				if (std::any_of(neighbours.begin(), neighbours.end(), [&](id_type neighbour) {
+					    return depth[neighbour - first] == next && kept[neighbour - first];
+				    }))
+				{
+					kept[word - first] = true;
+					survivors.push_back(word);
+				}
+			}
+		}
+
+		// graph ids are not in spelling order in general, so sort by spelling for the dag ids
+		std::sort(survivors.begin(), survivors.end(), [&](id_type a, id_type b) {
+			return graph.word(a) < graph.word(b);
+		});
+		auto ids = std::vector<std::uint32_t>(size);
+		auto dag = ladder_dag();
+		dag.words.reserve(survivors.size());
+		for (auto id = std::uint32_t{0}; id < survivors.size(); ++id) {
+			ids[survivors[id] - first] = id;
+			dag.words.emplace_back(graph.word(survivors[id]));
+		}
+		dag.offsets.reserve(survivors.size() + 1);
+		dag.offsets.push_back(0);
+		for (auto word : survivors) {
+			auto const begin = dag.targets.size();
+			for (auto neighbour : graph.neighbours(word)) {
+				if (depth[neighbour - first] == depth[word - first] + 1 && kept[neighbour - first]) {
+					dag.targets.push_back(ids[neighbour - first]);
+				}
+			}
+			std::sort(dag.targets.begin() + static_cast<std::ptrdiff_t>(begin), dag.targets.end());
+			dag.offsets.push_back(static_cast<std::uint32_t>(dag.targets.size()));
+		}
+		dag.source = ids[source - first];
+		dag.target = ids[target - first];
+		return dag;
+	}
+
+	auto generate(std::string const& from, std::string const& to, ladder_graph_view graph)
+	   -> std::vector<std::vector<std::string>> {
+		return enumerate_ladders(build_ladder_dag(from, to, graph));
+	}
+
+	// counting sort on the edge sources. sources are visited in ascending order, so every reversed
+	// successor list comes out ascending as well.
+	auto reverse(ladder_dag const& dag) -> ladder_dag {
+		auto reversed = ladder_dag();
+		if (dag.empty()) {
+			return reversed;
+		}
+		reversed.words = dag.words;
+		reversed.offsets.assign(dag.offsets.size(), 0);
+		for (auto target : dag.targets) {
+			++reversed.offsets[target + 1];
+		}
+		for (auto i = std::size_t{1}; i < reversed.offsets.size(); ++i) {
+			reversed.offsets[i] += reversed.offsets[i - 1];
+		}
+		reversed.targets.resize(dag.targets.size());
+		auto fill = std::vector<std::uint32_t>(reversed.offsets.begin(), reversed.offsets.end() - 1);
+		for (auto id = std::uint32_t{0}; id < dag.words.size(); ++id) {
+			for (auto successor : dag.successors(id)) {
+				reversed.targets[fill[successor]++] = id;
+			}
+		}
+		reversed.source = dag.target;
+		reversed.target = dag.source;
+		return reversed;
+	}
+
+	namespace {
+		// appends every ladder below the given prefix (a path from dag.source) to paths
+		auto enumerate_from(ladder_dag const& dag,
+		                    std::vector<std::uint32_t> const& prefix,
+		                    std::vector<std::vector<std::string>>& paths,
+		                    stop_check& stop) -> void {
+			auto curr_path = std::vector<std::string>();
+			for (auto id : prefix) {
+				curr_path.push_back(dag.words[id]);
+			}
+			curr_path.pop_back();
+			auto const walk = [&](auto const& self, std::uint32_t id) -> void {
+				stop.poll();
+				curr_path.push_back(dag.words[id]);
+				if (id == dag.target) {
+					paths.push_back(curr_path);
+				}
+				for (auto successor : dag.successors(id)) {
+					self(self, successor);
+				}
+				curr_path.pop_back();
+			};
+			walk(walk, prefix.back());
+		}
+	} // namespace
+
+	auto enumerate_ladders(ladder_dag const& dag) -> std::vector<std::vector<std::string>> {
+		auto never = stop_check();
+		return enumerate_ladders(dag, never);
+	}
+
+	auto enumerate_ladders(ladder_dag const& dag, stop_check& stop)
+	   -> std::vector<std::vector<std::string>> {
+		auto paths = std::vector<std::vector<std::string>>();
+		if (!dag.empty()) {
+			enumerate_from(dag, {dag.source}, paths, stop);
+		}
+		return paths;
+	}
+
+	// the dag is expanded breadth first from the source until there are a few prefixes per thread.
+	// expanding each prefix in successor order keeps the prefixes in lexicographic order, and every
+	// ladder below a prefix sorts before every ladder below the next one, so concatenating the
+	// per-prefix buffers in prefix order is already the lexicographic merge.
+	auto enumerate_ladders_parallel(ladder_dag const& dag, unsigned threads)
+	   -> std::vector<std::vector<std::string>> {
+		if (dag.empty()) {
+			return {};
+		}
+		if (threads == 0) {
+			threads = std::max(1U, std::thread::hardware_concurrency());
+		}
+		auto const wanted_prefixes = std::size_t{threads} * 8;
+		auto prefixes = std::vector<std::vector<std::uint32_t>>{{dag.source}};
+		while (prefixes.size() < wanted_prefixes && prefixes.front().back() != dag.target) {
+			auto expanded = std::vector<std::vector<std::uint32_t>>();
+			for (auto const& prefix : prefixes) {
+				for (auto successor : dag.successors(prefix.back())) {
+					expanded.push_back(prefix);
+					expanded.back().push_back(successor);
+				}
+			}
+			prefixes = std::move(expanded);
+		}
+
+		auto buffers = std::vector<std::vector<std::vector<std::string>>>(prefixes.size());
+		auto next = std::atomic<std::size_t>{0};
+		auto const worker = [&] {
+			auto never = stop_check();
+			for (auto i = next.fetch_add(1); i < prefixes.size(); i = next.fetch_add(1)) {
+				enumerate_from(dag, prefixes[i], buffers[i], never);
+			}
+		};
+		{
+			auto pool = std::vector<std::jthread>();
+			for (auto i = 1U; i < std::min<std::size_t>(threads, prefixes.size()); ++i) {
+				pool.emplace_back(worker);
+			}
+			worker();
+		}
+
+		auto total = std::size_t{0};
+		for (auto const& buffer : buffers) {
+			total += buffer.size();
+		}
+		auto paths = std::vector<std::vector<std::string>>();
+		paths.reserve(total);
+		for (auto& buffer : buffers) {
+			std::move(buffer.begin(), buffer.end(), std::back_inserter(paths));
+		}
+		return paths;
+	}
+
+	auto generate_parallel(std::string const& from,
+	                       std::string const& to,
+	                       std::unordered_set<std::string> const& lexicon,
+	                       unsigned threads) -> std::vector<std::vector<std::string>> {
+		return enumerate_ladders_parallel(build_ladder_dag(from, to, lexicon), threads);
+	}
+} // namespace word_ladder
@@ -0,0 +1,240 @@
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/position_alphabet.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace word_ladder {
+	namespace {
+		using id_type = ladder_graph_view::id_type;
+
+		// word offsets are 32 bits, so a graph's words are limited to 4 GiB of text
+		auto word_end(std::string const& chars) -> std::uint32_t {
+			if (chars.size() > std::numeric_limits<std::uint32_t>::max()) {
+				throw std::length_error("ladder_graph is limited to 4 GiB of words");
+			}
+			return static_cast<std::uint32_t>(chars.size());
+		}
+
+		// appends the words of one bucket to old_ids in breadth first order. every component is
+		// started from the first word of starts that is not yet visited, and neighbours are queued
+		// in the order given by before.
+		template<typename Before>
+		auto breadth_first(ladder_graph_view graph,
+		                   std::vector<id_type> const& starts,
+		                   Before before,
+		                   std::vector<bool>& visited,
+		                   std::vector<id_type>& old_ids) -> void {
+			auto neighbours = std::vector<id_type>();
+			for (auto start : starts) {
+				if (visited[start]) {
+					continue;
+				}
+				visited[start] = true;
+				old_ids.push_back(start);
+				for (auto i = old_ids.size() - 1; i < old_ids.size(); ++i) {
+					auto const word = old_ids[i];
+					auto const adjacent = graph.neighbours(word);
+					neighbours.assign(adjacent.begin(), adjacent.end());
+					std::stable_sort(neighbours.begin(), neighbours.end(), before);
+					for (auto neighbour : neighbours) {
+						if (!visited[neighbour]) {
+							visited[neighbour] = true;
+							old_ids.push_back(neighbour);
+						}
+					}
+				}
+			}
+		}
+
+		// the old id of every new id, bucket by bucket
+		auto reorder(ladder_graph_view graph, graph_order order) -> std::vector<id_type> {
+			auto const degree = [graph](id_type id) { return graph.neighbours(id).size(); };
+			auto old_ids = std::vector<id_type>();
+			old_ids.reserve(graph.size());
+			auto visited = std::vector<bool>(graph.size(), false);
+			for (auto length = std::size_t{0}; length <= graph.max_length(); ++length) {
+				auto const [first, last] = graph.bucket(length);
+				auto bucket = std::vector<id_type>(last - first);
+				for (auto id = first; id < last; ++id) {
+					bucket[id - first] = id;
+				}
+				switch (order) {
+				case graph_order::alphabetical:
+					old_ids.insert(old_ids.end(), bucket.begin(), bucket.end());
+					break;
+				case graph_order::bfs:
+					breadth_first(graph, bucket, std::less<>(), visited, old_ids);
+					break;
+				case graph_order::reverse_cuthill_mckee: {
+					auto const by_degree = [&](id_type a, id_type b) { return degree(a) < degree(b); };
+					std::stable_sort(bucket.begin(), bucket.end(), by_degree);
+					breadth_first(graph, bucket, by_degree, visited, old_ids);
+					std::reverse(old_ids.end() - static_cast<std::ptrdiff_t>(bucket.size()),
+					             old_ids.end());
+					break;
+				}
+				case graph_order::degree:
+					std::stable_sort(bucket.begin(), bucket.end(), [&](id_type a, id_type b) {
+						return degree(a) > degree(b);
+					});
+					old_ids.insert(old_ids.end(), bucket.begin(), bucket.end());
+					break;
+				}
+			}
+			return old_ids;
+		}
+	} // namespace
+
+	ladder_graph_view::ladder_graph_view(std::string_view chars,
+	                                     std::span<std::uint32_t const> word_offsets,
+	                                     std::span<std::uint64_t const> offsets,
+	                                     std::span<id_type const> targets,
+	                                     std::span<id_type const> by_word,
+	                                     std::span<id_type const> bucket_offsets)
+	: chars_(chars)
+	, word_offsets_(word_offsets)
+	, offsets_(offsets)
+	, targets_(targets)
+	, by_word_(by_word)
+	, bucket_offsets_(bucket_offsets) {}
+
+	auto ladder_graph_view::size() const -> std::size_t {
+		return by_word_.size();
+	}
+
+	auto ladder_graph_view::edge_count() const -> std::size_t {
+		return targets_.size();
+	}
+
+	auto ladder_graph_view::word(id_type id) const -> std::string_view {
+		return chars_.substr(word_offsets_[id], word_offsets_[id + 1] - word_offsets_[id]);
+	}
+
+	// binary search over the by_word order of the word's length bucket
+	auto ladder_graph_view::find(std::string_view word) const -> id_type {
+		auto const [first, last] = bucket(word.size());
+		auto const begin = by_word_.begin() + first;
+		auto const end = by_word_.begin() + last;
+		auto const found = std::lower_bound(begin, end, word, [this](id_type id, std::string_view key) {
+			return this->word(id) < key;
+		});
+		return found != end && this->word(*found) == word ? *found : npos;
+	}
+
+	auto ladder_graph_view::neighbours(id_type id) const -> std::span<id_type const> {
+		return targets_.subspan(offsets_[id], offsets_[id + 1] - offsets_[id]);
+	}
+
+	auto ladder_graph_view::max_length() const -> std::size_t {
+		return bucket_offsets_.empty() ? 0 : bucket_offsets_.size() - 2;
+	}
+
+	auto ladder_graph_view::bucket(std::size_t length) const -> std::pair<id_type, id_type> {
+		if (length + 1 >= bucket_offsets_.size()) {
+			return {0, 0};
+		}
+		return {bucket_offsets_[length], bucket_offsets_[length + 1]};
+	}
+
+	// ids are first assigned in (length, word) order. each word is then probed with every single letter
+	// substitution, through a temporary spelling to id map, using only the letters that occur at
+	// that position in its bucket.
+	ladder_graph::ladder_graph(std::unordered_set<std::string> const& lexicon, graph_order order) {
+		auto words = std::vector<std::string>(lexicon.begin(), lexicon.end());
+		std::sort(words.begin(), words.end(), [](auto const& a, auto const& b) {
+			return a.size() != b.size() ? a.size() < b.size() : a < b;
+		});
+		auto const max_length = words.empty() ? std::size_t{0} : words.back().size();
+
+		word_offsets_.reserve(words.size() + 1);
+		word_offsets_.push_back(0);
+		bucket_offsets_.assign(max_length + 2, 0);
+		for (auto const& word : words) {
+			chars_.append(word);
+			word_offsets_.push_back(word_end(chars_));
+			++bucket_offsets_[word.size() + 1];
+		}
+		for (auto length = std::size_t{1}; length < bucket_offsets_.size(); ++length) {
+			bucket_offsets_[length] += bucket_offsets_[length - 1];
+		}
+		by_word_.resize(words.size());
+		for (auto id = id_type{0}; id < words.size(); ++id) {
+			by_word_[id] = id;
+		}
+
+		auto ids = std::unordered_map<std::string_view, id_type>();
+		ids.reserve(words.size());
+		auto const graph = view();
+		for (auto id = id_type{0}; id < words.size(); ++id) {
+			ids.emplace(graph.word(id), id);
+		}
+
+		offsets_.reserve(words.size() + 1);
+		offsets_.push_back(0);
+		auto const alphabet = position_alphabet(lexicon);
+		auto candidate = std::string();
+		for (auto id = id_type{0}; id < words.size(); ++id) {
+			auto const first = targets_.size();
+			candidate = words[id];
+			for (auto i = std::size_t{0}; i < candidate.size(); ++i) {
+				for (auto letter : alphabet.letters(candidate.size(), i)) {
+					if (letter == words[id][i]) {
+						continue;
+					}
+					candidate[i] = letter;
+					auto const found = ids.find(candidate);
+					if (found != ids.end()) {
+						targets_.push_back(found->second);
+					}
+				}
+				candidate[i] = words[id][i];
+			}
+			std::sort(targets_.begin() + static_cast<std::ptrdiff_t>(first), targets_.end());
+			offsets_.push_back(targets_.size());
+		}
+		if (order != graph_order::alphabetical) {
+			renumber(reorder(view(), order));
+		}
+	}
+
+	auto ladder_graph::renumber(std::vector<id_type> const& old_ids) -> void {
+		auto const old = view();
+		auto new_ids = std::vector<id_type>(old_ids.size());
+		for (auto id = id_type{0}; id < old_ids.size(); ++id) {
+			new_ids[old_ids[id]] = id;
+		}
+
+		auto chars = std::string();
+		chars.reserve(chars_.size());
+		auto word_offsets = std::vector<std::uint32_t>{0};
+		word_offsets.reserve(word_offsets_.size());
+		auto offsets = std::vector<std::uint64_t>{0};
+		offsets.reserve(offsets_.size());
+		auto targets = std::vector<id_type>();
+		targets.reserve(targets_.size());
+		for (auto old_id : old_ids) {
+			chars.append(old.word(old_id));
+			word_offsets.push_back(word_end(chars));
+			auto const first = targets.size();
+			for (auto neighbour : old.neighbours(old_id)) {
+				targets.push_back(new_ids[neighbour]);
+			}
+			std::sort(targets.begin() + static_cast<std::ptrdiff_t>(first), targets.end());
+			offsets.push_back(targets.size());
+		}
+		// by_word was the identity, so the k-th word by spelling is now new_ids[k]
+		by_word_ = std::move(new_ids);
+		chars_ = std::move(chars);
+		word_offsets_ = std::move(word_offsets);
+		offsets_ = std::move(offsets);
+		targets_ = std::move(targets);
+	}
+
+	auto ladder_graph::view() const -> ladder_graph_view {
+		return {chars_, word_offsets_, offsets_, targets_, by_word_, bucket_offsets_};
+	}
+} // namespace word_ladder
@@ -0,0 +1,186 @@
+#include <comp6771/ladder_pairs.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <utility>
+
+namespace word_ladder {
+	namespace {
+		using id_type = ladder_graph_view::id_type;
+
+		constexpr auto unreached = std::numeric_limits<std::uint32_t>::max();
+		constexpr auto most_ladders = std::numeric_limits<std::uint64_t>::max();
+
+		auto saturating_add(std::uint64_t a, std::uint64_t b) -> std::uint64_t {
+			return a > most_ladders - b ? most_ladders : a + b;
+		}
+
+		// the ids sources are drawn from, by a partial fisher-yates shuffle
+		auto draw_sources(ladder_graph_view graph, ladder_pair_options const& options)
+		   -> std::vector<id_type> {
+			auto first = id_type{0};
+			auto last = static_cast<id_type>(graph.size());
+			if (options.length != 0) {
+				if (options.length > graph.max_length()) {
+					return {};
+				}
+				std::tie(first, last) = graph.bucket(options.length);
+			}
+			auto ids = std::vector<id_type>(last - first);
+			std::iota(ids.begin(), ids.end(), first);
+			if (options.sources >= ids.size()) {
+				return ids;
+			}
+			auto rng = std::mt19937_64(options.seed);
+			for (auto i = std::size_t{0}; i < options.sources; ++i) {
+				auto const j = i + static_cast<std::size_t>(rng() % (ids.size() - i));
+				std::swap(ids[i], ids[j]);
+			}
+			ids.resize(options.sources);
+			std::sort(ids.begin(), ids.end());
+			return ids;
+		}
+
+		// per thread bfs state, indexed by id - first of the current source's bucket
+		struct scratch {
+			std::vector<std::uint32_t> depth;
+			std::vector<std::uint64_t> ladders;
+			std::vector<id_type> queue;
+			std::vector<ladder_pair> pairs;
+
+			explicit scratch(std::size_t largest_bucket)
+			: depth(largest_bucket, unreached)
+			, ladders(largest_bucket, 0) {}
+		};
+
+		auto pairs_from(ladder_graph_view graph,
+		                id_type source,
+		                ladder_pair_options const& options,
+		                scratch& state) -> void {
+			auto const first = graph.bucket(graph.word(source).size()).first;
+			// one more than max_ladders is enough to tell a word is over it
+			auto const cap = options.max_ladders == most_ladders ? most_ladders
+			                                                     : options.max_ladders + 1;
+			auto& depth = state.depth;
+			auto& ladders = state.ladders;
+			auto& queue = state.queue;
+			queue.assign(1, source);
+			depth[source - first] = 0;
+			ladders[source - first] = 1;
+			// the level at the requested distance is complete once every word before it has been
+			// expanded, so the loop stops at the first word of that level
+			auto level_start = queue.size();
+			for (auto i = std::size_t{0}; i < queue.size(); ++i) {
+				auto const word = queue[i] - first;
+				if (depth[word] == options.distance) {
+					level_start = i;
+					break;
+				}
+				for (auto neighbour : graph.neighbours(queue[i])) {
+					auto const next = neighbour - first;
+					if (depth[next] == unreached) {
+						depth[next] = depth[word] + 1;
+						queue.push_back(neighbour);
+					}
+					if (depth[next] == depth[word] + 1) {
+						ladders[next] = std::min(cap, saturating_add(ladders[next], ladders[word]));
+					}
+				}
+			}
+
+			state.pairs.clear();
+			for (auto i = level_start; i < queue.size(); ++i) {
+				auto const word = queue[i] - first;
+				if (depth[word] == options.distance && ladders[word] <= options.max_ladders) {
+					state.pairs.push_back({source, queue[i], ladders[word]});
+				}
+			}
+			std::sort(state.pairs.begin(), state.pairs.end(), [](auto const& a, auto const& b) {
+				return a.to < b.to;
+			});
+			for (auto word : queue) {
+				depth[word - first] = unreached;
+				ladders[word - first] = 0;
+			}
+		}
+	} // namespace
+
+	auto find_ladder_pairs(ladder_graph_view graph,
+	                       ladder_pair_options const& options,
+	                       ladder_pair_sink const& sink) -> void {
+		auto const sources = draw_sources(graph, options);
+		if (sources.empty()) {
+			return;
+		}
+		auto largest_bucket = std::size_t{0};
+		for (auto length = std::size_t{0}; length <= graph.max_length(); ++length) {
+			auto const [first, last] = graph.bucket(length);
+			largest_bucket = std::max<std::size_t>(largest_bucket, last - first);
+		}
+
+		auto threads = options.threads;
+		if (threads == 0) {
+			threads = std::max(1U, std::thread::hardware_concurrency());
+		}
+		auto sink_lock = std::mutex();
+		auto next = std::atomic<std::size_t>{0};
+		// the first exception any worker meets (the sink's, or bad_alloc) stops the others taking
+		// more sources, and is rethrown here once they have all stopped
+		auto failure = std::exception_ptr();
+		auto const worker = [&] {
+			// still held when the sink throws, so no other thread calls the sink before the failure
+			// is recorded
+			auto lock = std::unique_lock(sink_lock, std::defer_lock);
+			try {
+				auto state = scratch(largest_bucket);
+				for (auto i = next.fetch_add(1); i < sources.size(); i = next.fetch_add(1)) {
+					pairs_from(graph, sources[i], options, state);
+					if (!state.pairs.empty()) {
+						lock.lock();
+						if (failure) {
+							return;
+						}
+						sink(state.pairs);
+						lock.unlock();
+					}
+				}
+			} catch (...) {
+				if (!lock.owns_lock()) {
+					lock.lock();
+				}
+				if (!failure) {
+					failure = std::current_exception();
+				}
+				next.store(sources.size());
+			}
+		};
+		{
+			auto pool = std::vector<std::jthread>();
+			for (auto i = 1U; i < std::min<std::size_t>(threads, sources.size()); ++i) {
+				pool.emplace_back(worker);
+			}
+			worker();
+		}
+		if (failure) {
+			std::rethrow_exception(failure);
+		}
+	}
+
+	auto find_ladder_pairs(ladder_graph_view graph, ladder_pair_options const& options)
+	   -> std::vector<ladder_pair> {
+		auto pairs = std::vector<ladder_pair>();
+		find_ladder_pairs(graph, options, [&](std::span<ladder_pair const> found) {
+			pairs.insert(pairs.end(), found.begin(), found.end());
+		});
+		std::sort(pairs.begin(), pairs.end(), [](auto const& a, auto const& b) {
+			return std::pair(a.from, a.to) < std::pair(b.from, b.to);
+		});
+		return pairs;
+	}
+} // namespace word_ladder
@@ -0,0 +1,78 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_query.hpp>
+
+#include <utility>
+
+namespace word_ladder {
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              std::unordered_set<std::string> const& lexicon,
+	              stop_check& stop) -> std::vector<std::vector<std::string>> {
+		auto const dag = build_ladder_dag(from, to, lexicon, stop);
+		return enumerate_ladders(dag, stop);
+	}
+
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              std::unordered_set<std::string> const& lexicon,
+	              position_alphabet const& alphabet,
+	              stop_check& stop) -> std::vector<std::vector<std::string>> {
+		auto const dag = build_ladder_dag(from, to, lexicon, alphabet, stop);
+		return enumerate_ladders(dag, stop);
+	}
+
+	auto generate(std::string const& from,
+	              std::string const& to,
+	              ladder_graph_view graph,
+	              stop_check& stop) -> std::vector<std::vector<std::string>> {
+		auto const dag = build_ladder_dag(from, to, graph, stop);
+		return enumerate_ladders(dag, stop);
+	}
+
+	auto generate_async(std::string from,
+	                    std::string to,
+	                    std::unordered_set<std::string> const& lexicon,
+	                    std::stop_token stop,
+	                    stop_check::clock::time_point deadline)
+	   -> std::future<std::vector<std::vector<std::string>>> {
+		auto query = [from = std::move(from),
+		              to = std::move(to),
+		              &lexicon,
+		              check = stop_check(std::move(stop), deadline)]() mutable {
+			return generate(from, to, lexicon, check);
+		};
+		return std::async(std::launch::async, std::move(query));
+	}
+
+	auto generate_async(std::string from,
+	                    std::string to,
+	                    std::unordered_set<std::string> const& lexicon,
+	                    position_alphabet const& alphabet,
+	                    std::stop_token stop,
+	                    stop_check::clock::time_point deadline)
+	   -> std::future<std::vector<std::vector<std::string>>> {
+		auto query = [from = std::move(from),
+		              to = std::move(to),
+		              &lexicon,
+		              &alphabet,
+		              check = stop_check(std::move(stop), deadline)]() mutable {
+			return generate(from, to, lexicon, alphabet, check);
+		};
+		return std::async(std::launch::async, std::move(query));
+	}
+
+	auto generate_async(std::string from,
+	                    std::string to,
+	                    ladder_graph_view graph,
+	                    std::stop_token stop,
+	                    stop_check::clock::time_point deadline)
+	   -> std::future<std::vector<std::vector<std::string>>> {
+		auto query = [from = std::move(from),
+		              to = std::move(to),
+		              graph,
+		              check = stop_check(std::move(stop), deadline)]() mutable {
+			return generate(from, to, graph, check);
+		};
+		return std::async(std::launch::async, std::move(query));
+	}
+} // namespace word_ladder
@@ -0,0 +1,134 @@
+#include <comp6771/ladder_sampler.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace word_ladder {
+	namespace {
+		// uniform double in [0, 1) built from the top 53 bits, so results do not depend on how the
+		// standard library implements uniform_real_distribution
+		auto unit_interval(std::mt19937_64& rng) -> double {
+			return static_cast<double>(rng() >> 11U) * 0x1.0p-53;
+		}
+	} // namespace
+
+	ladder_sampler::ladder_sampler(ladder_dag dag)
+	: dag_(std::move(dag)) {
+		if (dag_.empty()) {
+			return;
+		}
+		// every edge goes from one bfs level to the next, so bfs order from the source is a
+		// topological order and counting in reverse sees successors first
+		auto order = std::vector<std::uint32_t>{dag_.source};
+		auto seen = std::vector<bool>(dag_.words.size());
+		seen[dag_.source] = true;
+		for (auto i = std::size_t{0}; i < order.size(); ++i) {
+			for (auto successor : dag_.successors(order[i])) {
+				if (!seen[successor]) {
+					seen[successor] = true;
+					order.push_back(successor);
+				}
+			}
+		}
+		ladders_from_.assign(dag_.words.size(), 0);
+		ladders_from_[dag_.target] = 1;
+		for (auto id = order.rbegin(); id != order.rend(); ++id) {
+			for (auto successor : dag_.successors(*id)) {
+				ladders_from_[*id] += ladders_from_[successor];
+			}
+		}
+
+		// walker/vose alias table per word: column i keeps successor i with probability
+		// threshold_[i], otherwise takes successor alias_[i]
+		threshold_.assign(dag_.targets.size(), 1);
+		alias_.assign(dag_.targets.size(), 0);
+		auto small = std::vector<std::uint32_t>();
+		auto large = std::vector<std::uint32_t>();
+		for (auto id = std::uint32_t{0}; id < dag_.words.size(); ++id) {
+			auto const first = dag_.offsets[id];
+			auto const degree = dag_.offsets[id + 1] - first;
+			if (degree == 0) {
+				continue;
+			}
+			small.clear();
+			large.clear();
+			for (auto i = first; i < first + degree; ++i) {
+				threshold_[i] = ladders_from_[dag_.targets[i]] * degree / ladders_from_[id];
+				alias_[i] = i;
+				(threshold_[i] < 1 ? small : large).push_back(i);
+			}
+			while (!small.empty() && !large.empty()) {
+				auto const less = small.back();
+				auto const more = large.back();
+				small.pop_back();
+				alias_[less] = more;
+				threshold_[more] -= 1 - threshold_[less];
+				if (threshold_[more] < 1) {
+					large.pop_back();
+					small.push_back(more);
+				}
+			}
+			// whatever is left over only differs from 1 by rounding
+			for (auto i : small) {
+				threshold_[i] = 1;
+			}
+			for (auto i : large) {
+				threshold_[i] = 1;
+			}
+		}
+	}
+
+	auto ladder_sampler::count() const -> double {
+		return dag_.empty() ? 0 : ladders_from_[dag_.source];
+	}
+
+	auto ladder_sampler::sample(std::mt19937_64& rng) const -> std::vector<std::string> {
+		auto ladder = std::vector<std::string>();
+		if (dag_.empty()) {
+			return ladder;
+		}
+		auto id = dag_.source;
+		ladder.push_back(dag_.words[id]);
+		while (id != dag_.target) {
+			auto const first = dag_.offsets[id];
+			auto const degree = dag_.offsets[id + 1] - first;
+			auto const column = unit_interval(rng) * degree;
+			auto const slot = first + std::min(degree - 1, static_cast<std::uint32_t>(column));
+			auto const edge = column - (slot - first) < threshold_[slot] ? slot : alias_[slot];
+			id = dag_.targets[edge];
+			ladder.push_back(dag_.words[id]);
+		}
+		return ladder;
+	}
+
+	auto ladder_sampler::sample(std::size_t k, std::uint64_t seed) const
+	   -> std::vector<std::vector<std::string>> {
+		auto rng = std::mt19937_64(seed);
+		auto ladders = std::vector<std::vector<std::string>>();
+		if (dag_.empty()) {
+			return ladders;
+		}
+		ladders.reserve(k);
+		for (auto i = std::size_t{0}; i < k; ++i) {
+			ladders.push_back(sample(rng));
+		}
+		return ladders;
+	}
+
+	auto sample_ladders(std::string const& from,
+	                    std::string const& to,
+	                    std::unordered_set<std::string> const& lexicon,
+	                    std::size_t k,
+	                    std::uint64_t seed) -> std::vector<std::vector<std::string>> {
+		return ladder_sampler(build_ladder_dag(from, to, lexicon)).sample(k, seed);
+	}
+
+	auto sample_ladders(std::string const& from,
+	                    std::string const& to,
+	                    std::unordered_set<std::string> const& lexicon,
+	                    position_alphabet const& alphabet,
+	                    std::size_t k,
+	                    std::uint64_t seed) -> std::vector<std::vector<std::string>> {
+		return ladder_sampler(build_ladder_dag(from, to, lexicon, alphabet)).sample(k, seed);
+	}
+} // namespace word_ladder
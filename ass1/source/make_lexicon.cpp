@@ -0,0 +1,127 @@
+#include <comp6771/command_line.hpp>
+#include <comp6771/synthetic_lexicon.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// writes a synthetic lexicon (see synthetic_lexicon_options) for scale testing. --lengths takes a
+// comma separated weight per length, starting at --min-length.
+//
+// usage: make_lexicon --output path [--words n] [--min-length n] [--max-length n]
+//                     [--lengths w,w,...] [--alphabet letters] [--density d] [--seed n]
+
+namespace {
+	auto usage() -> void {
+		std::cerr << "usage: make_lexicon --output path [--words n] [--min-length n] [--max-length n] "
+		             "[--lengths w,w,...] [--alphabet letters] [--density d] [--seed n]\n";
+	}
+
+	// the whole of text as a real number, or nothing (so that --density 0.5x is a usage error
+	// rather than 0.5)
+	auto parse_real(std::string const& option, std::string const& text) -> std::optional<double> {
+		try {
+			auto end = std::size_t{0};
+			auto const real = std::stod(text, &end);
+			if (end == text.size()) {
+				return real;
+			}
+		} catch (std::logic_error const&) {
+			// std::invalid_argument or std::out_of_range
+		}
+		std::cerr << "make_lexicon: " << option << " expects a number, not \"" << text << "\"\n";
+		return std::nullopt;
+	}
+
+	auto parse_weights(std::string const& list) -> std::optional<std::vector<double>> {
+		auto weights = std::vector<double>();
+		auto in = std::istringstream(list);
+		auto weight = std::string();
+		while (std::getline(in, weight, ',')) {
+			auto const real = parse_real("--lengths", weight);
+			if (!real) {
+				return std::nullopt;
+			}
+			weights.push_back(*real);
+		}
+		return weights;
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	auto options = word_ladder::synthetic_lexicon_options();
+	auto output = std::string();
+	auto const args = std::vector<std::string>(argv + 1, argv + argc);
+	for (auto i = std::size_t{0}; i < args.size(); ++i) {
+		if (i + 1 >= args.size()) {
+			usage();
+			return 2;
+		}
+		auto const& value = args[i + 1];
+		if (args[i] == "--output") {
+			output = value;
+		}
+		else if (args[i] == "--words" || args[i] == "--min-length" || args[i] == "--max-length"
+		         || args[i] == "--seed")
+		{
+			auto const count = word_ladder::parse_count("make_lexicon", args[i], value);
+			if (!count) {
+				usage();
+				return 2;
+			}
+			if (args[i] == "--words") {
+				options.words = static_cast<std::size_t>(*count);
+			}
+			else if (args[i] == "--min-length") {
+				options.min_length = static_cast<std::size_t>(*count);
+			}
+			else if (args[i] == "--max-length") {
+				options.max_length = static_cast<std::size_t>(*count);
+			}
+			else {
+				options.seed = *count;
+			}
+		}
+		else if (args[i] == "--lengths") {
+			auto weights = parse_weights(value);
+			if (!weights) {
+				usage();
+				return 2;
+			}
+			options.length_weights = std::move(*weights);
+		}
+		else if (args[i] == "--alphabet") {
+			options.alphabet = value;
+		}
+		else if (args[i] == "--density") {
+			auto const density = parse_real(args[i], value);
+			if (!density) {
+				usage();
+				return 2;
+			}
+			options.density = *density;
+		}
+		else {
+			usage();
+			return 2;
+		}
+		++i;
+	}
+	if (output.empty()) {
+		usage();
+		return 2;
+	}
+
+	try {
+		word_ladder::write_lexicon(word_ladder::generate_synthetic_lexicon(options), output);
+	} catch (std::exception const& e) {
+		std::cerr << "make_lexicon: " << e.what() << "\n";
+		return 1;
+	}
+}
@@ -0,0 +1,166 @@
+#include <comp6771/mapped_ladder_graph.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace word_ladder {
+	namespace {
+		constexpr auto magic = std::array<char, 8>{'W', 'L', 'G', 'R', 'A', 'P', 'H', '1'};
+		constexpr auto alignment = std::uint64_t{8};
+
+		enum section : std::size_t { chars, word_offsets, offsets, targets, by_word, bucket_offsets };
+		constexpr auto section_count = std::size_t{6};
+
+		// every section is located by its byte offset from the start of the file and its element
+		// count, so nothing in the file depends on where it is mapped
+		struct file_header {
+			std::array<char, 8> magic;
+			std::array<std::uint64_t, section_count> offset;
+			std::array<std::uint64_t, section_count> count;
+		};
+
+		constexpr auto element_size = std::array<std::uint64_t, section_count>{
+		   sizeof(char),
+		   sizeof(std::uint32_t),
+		   sizeof(std::uint64_t),
+		   sizeof(ladder_graph_view::id_type),
+		   sizeof(ladder_graph_view::id_type),
+		   sizeof(ladder_graph_view::id_type)};
+
+		auto pad(std::ofstream& out) -> void {
+			constexpr auto zeros = std::array<char, alignment>{};
+			auto const position = static_cast<std::uint64_t>(out.tellp());
+			auto const padding = (alignment - position % alignment) % alignment;
+			out.write(zeros.data(), static_cast<std::streamsize>(padding));
+		}
+
+		template<typename T>
+		auto section_span(char const* base, file_header const& header, section s)
+		   -> std::span<T const> {
+			return {reinterpret_cast<T const*>(base + header.offset[s]), header.count[s]};
+		}
+	} // namespace
+
+	auto save_ladder_graph(ladder_graph_view graph, std::string const& path) -> void {
+		auto const temporary = path + ".tmp";
+		{
+			auto out = std::ofstream(temporary, std::ios::binary | std::ios::trunc);
+			if (not out) {
+				throw std::runtime_error("Unable to open file.");
+			}
+			auto const bytes = [](auto span) {
+				return std::pair{reinterpret_cast<char const*>(span.data()), std::uint64_t{span.size()}};
+			};
+			auto const data = std::array<std::pair<char const*, std::uint64_t>, section_count>{
+			   bytes(graph.chars_),
+			   bytes(graph.word_offsets_),
+			   bytes(graph.offsets_),
+			   bytes(graph.targets_),
+			   bytes(graph.by_word_),
+			   bytes(graph.bucket_offsets_)};
+
+			// the header is written twice: once to reserve its space, then again with the offsets
+			auto header = file_header{magic, {}, {}};
+			out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+			for (auto s = std::size_t{0}; s < section_count; ++s) {
+				pad(out);
+				header.offset[s] = static_cast<std::uint64_t>(out.tellp());
+				header.count[s] = data[s].second;
+				auto const size = data[s].second * element_size[s];
+				out.write(data[s].first, static_cast<std::streamsize>(size));
+			}
+			out.seekp(0);
+			out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+			if (not out) {
+				throw std::runtime_error("I/O error while writing");
+			}
+		}
+		if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+			std::remove(temporary.c_str());
+			throw std::runtime_error("I/O error while writing");
+		}
+	}
+
+	mapped_ladder_graph::mapped_ladder_graph(std::string const& path) {
+		auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) {
+			throw std::runtime_error("Unable to open file.");
+		}
+		struct stat status {};
+		if (::fstat(fd, &status) != 0
+		    || static_cast<std::uint64_t>(status.st_size) < sizeof(file_header))
+		{
+			::close(fd);
+			throw std::runtime_error("Not a ladder graph file.");
+		}
+		length_ = static_cast<std::size_t>(status.st_size);
+		auto* const address = ::mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+		// the mapping keeps the file alive on its own
+		::close(fd);
+		if (address == MAP_FAILED) {
+			throw std::runtime_error("Unable to map file.");
+		}
+		address_ = address;
+
+		auto const* const base = static_cast<char const*>(address_);
+		auto const& header = *reinterpret_cast<file_header const*>(base);
+		auto valid = header.magic == magic;
+		for (auto s = std::size_t{0}; valid && s < section_count; ++s) {
+			valid = header.offset[s] % alignment == 0 && header.offset[s] >= sizeof(file_header)
+			        && header.offset[s] <= length_
+			        && header.count[s] <= (length_ - header.offset[s]) / element_size[s];
+		}
+		// one id per word, and one offset past the last word in each offset array
+		valid = valid && header.count[offsets] == header.count[word_offsets]
+		        && (header.count[word_offsets] == header.count[by_word] + 1
+		            || (header.count[word_offsets] == 0 && header.count[by_word] == 0));
+		if (not valid) {
+			::munmap(address_, length_);
+			throw std::runtime_error("Not a ladder graph file.");
+		}
+		using id_type = ladder_graph_view::id_type;
+		view_ = ladder_graph_view({base + header.offset[chars], header.count[chars]},
+		                          section_span<std::uint32_t>(base, header, word_offsets),
+		                          section_span<std::uint64_t>(base, header, offsets),
+		                          section_span<id_type>(base, header, targets),
+		                          section_span<id_type>(base, header, by_word),
+		                          section_span<id_type>(base, header, bucket_offsets));
+	}
+
+	mapped_ladder_graph::mapped_ladder_graph(mapped_ladder_graph&& other) noexcept
+	: address_(std::exchange(other.address_, nullptr))
+	, length_(std::exchange(other.length_, 0))
+	, view_(std::exchange(other.view_, {})) {}
+
+	auto mapped_ladder_graph::operator=(mapped_ladder_graph&& other) noexcept
+	   -> mapped_ladder_graph& {
+		if (this != &other) {
+			if (address_ != nullptr) {
+				::munmap(address_, length_);
+			}
+			address_ = std::exchange(other.address_, nullptr);
+			length_ = std::exchange(other.length_, 0);
+			view_ = std::exchange(other.view_, {});
+		}
+		return *this;
+	}
+
+	mapped_ladder_graph::~mapped_ladder_graph() {
+		if (address_ != nullptr) {
+			::munmap(address_, length_);
+		}
+	}
+
+	auto mapped_ladder_graph::view() const -> ladder_graph_view {
+		return view_;
+	}
+} // namespace word_ladder
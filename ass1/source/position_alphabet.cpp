@@ -0,0 +1,94 @@
+#include <comp6771/position_alphabet.hpp>
+
+#include <algorithm>
+
+namespace word_ladder {
+	namespace {
+		auto byte_of(char letter) -> unsigned {
+			return static_cast<unsigned char>(letter);
+		}
+	} // namespace
+
+	position_alphabet::position_alphabet(std::unordered_set<std::string> const& lexicon) {
+		auto never = stop_check();
+		*this = position_alphabet(lexicon, never);
+	}
+
+	position_alphabet::position_alphabet(std::unordered_set<std::string> const& lexicon,
+	                                     stop_check& stop) {
+		for (auto const& word : lexicon) {
+			stop.poll();
+			max_length_ = std::max(max_length_, word.size());
+		}
+		masks_.assign(row(max_length_ + 1, 0), {});
+		for (auto const& word : lexicon) {
+			stop.poll();
+			for (auto i = std::size_t{0}; i < word.size(); ++i) {
+				auto const byte = byte_of(word[i]);
+				masks_[row(word.size(), i)][byte / 64] |= std::uint64_t{1} << (byte % 64);
+			}
+		}
+
+		letter_offsets_.reserve(masks_.size() + 1);
+		letter_offsets_.push_back(0);
+		for (auto const& mask : masks_) {
+			for (auto byte = 0U; byte < 256; ++byte) {
+				if ((mask[byte / 64] >> (byte % 64) & 1U) != 0) {
+					letters_.push_back(static_cast<char>(byte));
+				}
+			}
+			letter_offsets_.push_back(static_cast<std::uint32_t>(letters_.size()));
+		}
+	}
+
+	auto position_alphabet::row(std::size_t length, std::size_t position) -> std::size_t {
+		return length * (length - 1) / 2 + position;
+	}
+
+	auto position_alphabet::letters(std::size_t length, std::size_t position) const
+	   -> std::string_view {
+		if (length > max_length_ || position >= length) {
+			return {};
+		}
+		auto const r = row(length, position);
+		return std::string_view(letters_).substr(letter_offsets_[r],
+		                                         letter_offsets_[r + 1] - letter_offsets_[r]);
+	}
+
+	auto position_alphabet::contains(std::size_t length, std::size_t position, char letter) const
+	   -> bool {
+		if (length > max_length_ || position >= length) {
+			return false;
+		}
+		auto const byte = byte_of(letter);
+		return (masks_[row(length, position)][byte / 64] >> (byte % 64) & 1U) != 0;
+	}
+
+	auto position_alphabet::max_length() const -> std::size_t {
+		return max_length_;
+	}
+
+	auto singleLetterDiff(std::string const& word,
+	                      std::unordered_set<std::string> const& lexicon,
+	                      position_alphabet const& alphabet,
+	                      std::deque<std::string>& single_letter_diff_queue,
+	                      std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map)
+	   -> void {
+		auto candidate = word;
+		auto diff_words = std::vector<std::string>();
+		for (auto i = std::size_t{0}; i < word.size(); ++i) {
+			for (auto letter : alphabet.letters(word.size(), i)) {
+				if (letter == word[i]) {
+					continue;
+				}
+				candidate[i] = letter;
+				if (lexicon.contains(candidate)) {
+					diff_words.push_back(candidate);
+					single_letter_diff_queue.push_back(candidate);
+				}
+			}
+			candidate[i] = word[i];
+		}
+		single_letter_diff_map[word] = std::move(diff_words);
+	}
+} // namespace word_ladder
@@ -0,0 +1,142 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/probe_lexicon.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace word_ladder {
+	namespace {
+		auto hash_of(std::string_view word) -> std::uint64_t {
+			return std::hash<std::string_view>{}(word);
+		}
+
+		auto prefetch(void const* address) -> void {
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_prefetch(address, 0, 3);
+#else
+			static_cast<void>(address);
+#endif
+		}
+	} // namespace
+
+	probe_lexicon::probe_lexicon(std::unordered_set<std::string> const& lexicon)
+	: alphabet_(lexicon) {
+		auto const capacity = std::bit_ceil(std::max(std::size_t{16}, lexicon.size() * 2));
+		slots_.resize(capacity);
+		for (auto const& word : lexicon) {
+			if (word.empty()) {
+				has_empty_word_ = true;
+				continue;
+			}
+			// slots hold 32 bit offsets and lengths, so the words are limited to 4 GiB of text
+			if (word.size() > std::numeric_limits<std::uint32_t>::max() - chars_.size()) {
+				throw std::length_error("probe_lexicon is limited to 4 GiB of words");
+			}
+			auto const hash = hash_of(word);
+			auto i = home(hash);
+			while (slots_[i].length != 0) {
+				i = (i + 1) & (slots_.size() - 1);
+			}
+			slots_[i] = {hash,
+			             static_cast<std::uint32_t>(chars_.size()),
+			             static_cast<std::uint32_t>(word.size())};
+			chars_.append(word);
+		}
+		size_ = lexicon.size();
+	}
+
+	auto probe_lexicon::home(std::uint64_t hash) const -> std::size_t {
+		return static_cast<std::size_t>(hash) & (slots_.size() - 1);
+	}
+
+	auto probe_lexicon::resolve(std::string_view word, std::uint64_t hash) const -> bool {
+		if (word.empty()) {
+			return has_empty_word_;
+		}
+		for (auto i = home(hash); slots_[i].length != 0; i = (i + 1) & (slots_.size() - 1)) {
+			auto const& s = slots_[i];
+			if (s.hash == hash && std::string_view(chars_).substr(s.offset, s.length) == word) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	auto probe_lexicon::contains(std::string_view word) const -> bool {
+		return !slots_.empty() && resolve(word, hash_of(word));
+	}
+
+	auto probe_lexicon::contains(std::span<std::string_view const> words, std::span<bool> found) const
+	   -> void {
+		if (slots_.empty()) {
+			std::fill_n(found.begin(), words.size(), false);
+			return;
+		}
+		auto hashes = std::array<std::uint64_t, batch_size>();
+		for (auto first = std::size_t{0}; first < words.size(); first += batch_size) {
+			auto const count = std::min(batch_size, words.size() - first);
+			for (auto i = std::size_t{0}; i < count; ++i) {
+				hashes[i] = hash_of(words[first + i]);
+				prefetch(&slots_[home(hashes[i])]);
+			}
+			for (auto i = std::size_t{0}; i < count; ++i) {
+				found[first + i] = resolve(words[first + i], hashes[i]);
+			}
+		}
+	}
+
+	auto probe_lexicon::size() const -> std::size_t {
+		return size_;
+	}
+
+	// every candidate is spelled out in one buffer first, so they can all be probed together
+	auto probe_lexicon::neighbours(std::string const& word) const -> std::vector<std::string> {
+		auto buffer = std::string();
+		auto candidates = std::vector<std::string_view>();
+		for (auto i = std::size_t{0}; i < word.size(); ++i) {
+			for (auto letter : alphabet_.letters(word.size(), i)) {
+				if (letter != word[i]) {
+					buffer.append(word);
+					buffer[buffer.size() - word.size() + i] = letter;
+				}
+			}
+		}
+		for (auto offset = std::size_t{0}; offset < buffer.size(); offset += word.size()) {
+			candidates.emplace_back(buffer.data() + offset, word.size());
+		}
+		auto const found = std::make_unique<bool[]>(candidates.size());
+		contains(candidates, {found.get(), candidates.size()});
+
+		auto result = std::vector<std::string>();
+		for (auto i = std::size_t{0}; i < candidates.size(); ++i) {
+			if (found[i]) {
+				result.emplace_back(candidates[i]);
+			}
+		}
+		return result;
+	}
+
+	auto singleLetterDiff(std::string const& word,
+	                      probe_lexicon const& lexicon,
+	                      std::deque<std::string>& single_letter_diff_queue,
+	                      std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map)
+	   -> void {
+		auto neighbours = lexicon.neighbours(word);
+		single_letter_diff_queue.insert(single_letter_diff_queue.end(),
+		                                neighbours.begin(),
+		                                neighbours.end());
+		single_letter_diff_map[word] = std::move(neighbours);
+	}
+
+	auto generate(std::string const& from, std::string const& to, probe_lexicon const& lexicon)
+	   -> std::vector<std::vector<std::string>> {
+		return enumerate_ladders(build_ladder_dag(from, to, [&lexicon](std::string const& word) {
+			return lexicon.neighbours(word);
+		}));
+	}
+} // namespace word_ladder
@@ -0,0 +1,48 @@
+#include <comp6771/radix_heap.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace word_ladder {
+	auto radix_heap::bucket_of(key_type key) const -> std::size_t {
+		return key == last_ ? 0 : static_cast<std::size_t>(std::bit_width(key ^ last_));
+	}
+
+	auto radix_heap::push(key_type key, value_type value) -> void {
+		if (key < last_) {
+			throw std::logic_error("Radix heap keys must not decrease.");
+		}
+		buckets_[bucket_of(key)].emplace_back(key, value);
+		++size_;
+	}
+
+	auto radix_heap::pop() -> std::pair<key_type, value_type> {
+		if (buckets_[0].empty()) {
+			auto i = std::size_t{1};
+			while (buckets_[i].empty()) {
+				++i;
+			}
+			auto& bucket = buckets_[i];
+			last_ = std::min_element(bucket.begin(), bucket.end())->first;
+			// every key here shares its bits above i - 1 with the new minimum, so each one lands in
+			// a bucket below i
+			for (auto const& entry : bucket) {
+				buckets_[bucket_of(entry.first)].push_back(entry);
+			}
+			bucket.clear();
+		}
+		auto const entry = buckets_[0].back();
+		buckets_[0].pop_back();
+		--size_;
+		return entry;
+	}
+
+	auto radix_heap::empty() const -> bool {
+		return size_ == 0;
+	}
+
+	auto radix_heap::size() const -> std::size_t {
+		return size_;
+	}
+} // namespace word_ladder
@@ -0,0 +1,140 @@
+#include <comp6771/command_line.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <unordered_set>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+// scale test for a lexicon file (e.g. one written by make_lexicon): times read_lexicon, then runs
+// generate between random pairs of same length words, and reports wall times alongside resident
+// memory after loading and at its peak. output is one "key: value" line per measurement, so runs
+// over growing lexicons can be collected and compared.
+//
+// usage: scale_harness --lexicon path [--queries n] [--seed n]
+
+namespace {
+	// current resident set in bytes, from /proc/self/statm
+	auto resident_bytes() -> std::uint64_t {
+		auto statm = std::ifstream("/proc/self/statm");
+		auto pages = std::uint64_t{0};
+		auto resident = std::uint64_t{0};
+		statm >> pages >> resident;
+		return resident * static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+	}
+
+	// peak resident set in bytes (ru_maxrss is in kilobytes on linux)
+	auto peak_resident_bytes() -> std::uint64_t {
+		auto usage = rusage();
+		::getrusage(RUSAGE_SELF, &usage);
+		return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+	}
+
+	auto megabytes(std::uint64_t bytes) -> double {
+		return static_cast<double>(bytes) / (1024.0 * 1024.0);
+	}
+
+	auto seconds_since(std::chrono::steady_clock::time_point start) -> double {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	auto lexicon_path = std::string();
+	auto queries = std::size_t{20};
+	auto seed = std::uint64_t{1};
+	auto const args = std::vector<std::string>(argv + 1, argv + argc);
+	for (auto i = std::size_t{0}; i < args.size(); ++i) {
+		auto const has_value = i + 1 < args.size();
+		if (args[i] == "--lexicon" && has_value) {
+			lexicon_path = args[++i];
+		}
+		else if ((args[i] == "--queries" || args[i] == "--seed") && has_value) {
+			auto const count = word_ladder::parse_count("scale_harness", args[i], args[i + 1]);
+			if (!count) {
+				lexicon_path.clear();
+				break;
+			}
+			if (args[i] == "--queries") {
+				queries = static_cast<std::size_t>(*count);
+			}
+			else {
+				seed = *count;
+			}
+			++i;
+		}
+		else {
+			lexicon_path.clear();
+			break;
+		}
+	}
+	if (lexicon_path.empty()) {
+		std::cerr << "usage: scale_harness --lexicon path [--queries n] [--seed n]\n";
+		return 2;
+	}
+
+	auto const baseline = resident_bytes();
+	auto const load_start = std::chrono::steady_clock::now();
+	auto lexicon = std::unordered_set<std::string>();
+	try {
+		lexicon = word_ladder::read_lexicon(lexicon_path);
+	} catch (std::exception const& e) {
+		std::cerr << "scale_harness: " << lexicon_path << ": " << e.what() << "\n";
+		return 1;
+	}
+	auto const load_seconds = seconds_since(load_start);
+	auto const loaded = resident_bytes();
+	auto const alphabet = word_ladder::position_alphabet(lexicon);
+
+	// query endpoints are drawn from the sorted word list, so a seed names the same queries on
+	// every run. the list points into the lexicon (whose nodes never move) rather than copying
+	// every word, which would double the footprint the peak resident figure is meant to measure.
+	auto words = std::vector<std::string const*>();
+	words.reserve(lexicon.size());
+	for (auto const& word : lexicon) {
+		words.push_back(&word);
+	}
+	std::sort(words.begin(), words.end(), [](auto const* a, auto const* b) {
+		return a->size() != b->size() ? a->size() < b->size() : *a < *b;
+	});
+	auto rng = std::mt19937_64(seed);
+	auto latencies = std::vector<double>();
+	auto ladders = std::size_t{0};
+	auto connected = std::size_t{0};
+	auto const run_start = std::chrono::steady_clock::now();
+	for (auto q = std::size_t{0}; q < queries && !words.empty(); ++q) {
+		auto const& from = *words[rng() % words.size()];
+		auto const by_length = [](auto const* a, auto const* b) { return a->size() < b->size(); };
+		auto const [first, last] = std::equal_range(words.begin(), words.end(), &from, by_length);
+		auto const choices = static_cast<std::uint64_t>(last - first);
+		auto const& to = *first[static_cast<std::ptrdiff_t>(rng() % choices)];
+		auto const start = std::chrono::steady_clock::now();
+		auto const result = word_ladder::generate(from, to, lexicon, alphabet);
+		latencies.push_back(seconds_since(start));
+		ladders += result.size();
+		connected += result.empty() ? std::size_t{0} : std::size_t{1};
+	}
+	auto const run_seconds = seconds_since(run_start);
+	std::sort(latencies.begin(), latencies.end());
+
+	std::cout << "lexicon: " << lexicon_path << "\n"
+	          << "words: " << lexicon.size() << "\n"
+	          << "read_lexicon seconds: " << load_seconds << "\n"
+	          << "lexicon resident mb: " << megabytes(loaded - std::min(loaded, baseline)) << "\n"
+	          << "queries: " << latencies.size() << " (" << connected << " connected)\n"
+	          << "ladders: " << ladders << "\n"
+	          << "generate seconds: " << run_seconds << "\n"
+	          << "generate median seconds: "
+	          << (latencies.empty() ? 0.0 : latencies[latencies.size() / 2]) << "\n"
+	          << "generate max seconds: " << (latencies.empty() ? 0.0 : latencies.back()) << "\n"
+	          << "peak resident mb: " << megabytes(peak_resident_bytes()) << "\n";
+}
@@ -0,0 +1,28 @@
+#include <comp6771/stop_check.hpp>
+
+#include <utility>
+
+namespace word_ladder {
+	ladder_query_stopped::ladder_query_stopped(bool deadline_passed)
+	: std::runtime_error(deadline_passed ? "Ladder query missed its deadline."
+	                                     : "Ladder query was stopped.")
+	, deadline_passed_(deadline_passed) {}
+
+	auto ladder_query_stopped::deadline_passed() const -> bool {
+		return deadline_passed_;
+	}
+
+	stop_check::stop_check(std::stop_token token, clock::time_point deadline)
+	: token_(std::move(token))
+	, deadline_(deadline) {}
+
+	auto stop_check::check() -> void {
+		countdown_ = interval;
+		if (token_.stop_requested()) {
+			throw ladder_query_stopped(false);
+		}
+		if (deadline_ != clock::time_point::max() && clock::now() >= deadline_) {
+			throw ladder_query_stopped(true);
+		}
+	}
+} // namespace word_ladder
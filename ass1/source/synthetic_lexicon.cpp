@@ -0,0 +1,113 @@
+#include <comp6771/synthetic_lexicon.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+
+namespace word_ladder {
+	namespace {
+		// uniform double in [0, 1) built from the top 53 bits, so the lexicon for a seed does not
+		// depend on how the standard library implements its distributions
+		auto unit_interval(std::mt19937_64& rng) -> double {
+			return static_cast<double>(rng() >> 11U) * 0x1.0p-53;
+		}
+
+		auto uniform_index(std::mt19937_64& rng, std::size_t size) -> std::size_t {
+			auto const index = static_cast<std::size_t>(unit_interval(rng) * static_cast<double>(size));
+			return std::min(size - 1, index);
+		}
+	} // namespace
+
+	// words are drawn in rounds. each round draws as many candidates as words are still missing,
+	// then every length's pool is sorted and deduplicated, so no round can overshoot. a length whose
+	// pool holds every possible spelling stops being drawn.
+	auto generate_synthetic_lexicon(synthetic_lexicon_options const& options)
+	   -> std::vector<std::string> {
+		auto alphabet = options.alphabet;
+		std::sort(alphabet.begin(), alphabet.end());
+		alphabet.erase(std::unique(alphabet.begin(), alphabet.end()), alphabet.end());
+		if (alphabet.empty() || options.min_length == 0 || options.min_length > options.max_length) {
+			throw std::invalid_argument("Invalid synthetic lexicon options.");
+		}
+
+		auto const lengths = options.max_length - options.min_length + 1;
+		auto weights = std::vector<double>(lengths, 0.0);
+		auto capacity = std::vector<double>(lengths);
+		auto total_capacity = 0.0;
+		for (auto i = std::size_t{0}; i < lengths; ++i) {
+			if (options.length_weights.empty()) {
+				weights[i] = 1.0;
+			}
+			else if (i < options.length_weights.size()) {
+				weights[i] = std::max(0.0, options.length_weights[i]);
+			}
+			capacity[i] = std::pow(static_cast<double>(alphabet.size()),
+			                       static_cast<double>(options.min_length + i));
+			total_capacity += weights[i] > 0 ? capacity[i] : 0.0;
+		}
+		if (total_capacity < static_cast<double>(options.words)) {
+			throw std::invalid_argument("Not enough distinct words of the given lengths.");
+		}
+
+		auto rng = std::mt19937_64(options.seed);
+		auto pools = std::vector<std::vector<std::string>>(lengths);
+		auto total = std::size_t{0};
+		auto cumulative = std::vector<double>(lengths);
+		while (total < options.words) {
+			for (auto i = std::size_t{0}; i < lengths; ++i) {
+				auto const open = static_cast<double>(pools[i].size()) < capacity[i];
+				cumulative[i] = (i == 0 ? 0.0 : cumulative[i - 1]) + (open ? weights[i] : 0.0);
+			}
+			for (auto remaining = options.words - total; remaining > 0; --remaining) {
+				auto const pick = unit_interval(rng) * cumulative.back();
+				auto const slot = std::upper_bound(cumulative.begin(), cumulative.end(), pick);
+				auto const i = std::min(lengths - 1, static_cast<std::size_t>(slot - cumulative.begin()));
+				auto& pool = pools[i];
+				auto const length = options.min_length + i;
+				if (!pool.empty() && unit_interval(rng) < options.density) {
+					auto word = pool[uniform_index(rng, pool.size())];
+					word[uniform_index(rng, length)] = alphabet[uniform_index(rng, alphabet.size())];
+					pool.push_back(std::move(word));
+				}
+				else {
+					auto word = std::string(length, ' ');
+					for (auto& letter : word) {
+						letter = alphabet[uniform_index(rng, alphabet.size())];
+					}
+					pool.push_back(std::move(word));
+				}
+			}
+			total = 0;
+			for (auto& pool : pools) {
+				std::sort(pool.begin(), pool.end());
+				pool.erase(std::unique(pool.begin(), pool.end()), pool.end());
+				total += pool.size();
+			}
+		}
+
+		auto words = std::vector<std::string>();
+		words.reserve(total);
+		for (auto& pool : pools) {
+			std::move(pool.begin(), pool.end(), std::back_inserter(words));
+			pool = std::vector<std::string>();
+		}
+		std::sort(words.begin(), words.end());
+		return words;
+	}
+
+	auto write_lexicon(std::vector<std::string> const& words, std::string const& path) -> void {
+		auto out = std::ofstream(path);
+		if (not out) {
+			throw std::runtime_error("Unable to open file.");
+		}
+		for (auto const& word : words) {
+			out << word << '\n';
+		}
+		if (not out) {
+			throw std::runtime_error("I/O error while writing");
+		}
+	}
+} // namespace word_ladder
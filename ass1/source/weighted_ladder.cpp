@@ -0,0 +1,223 @@
+#include <comp6771/radix_heap.hpp>
+#include <comp6771/weighted_ladder.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace word_ladder {
+	namespace {
+		constexpr auto unreached = std::numeric_limits<std::uint64_t>::max();
+
+		// final costs by node id. nodes may be numbered while the search runs, so the array grows
+		// on demand.
+		struct search {
+			std::vector<std::uint64_t> cost;
+
+			auto grow(std::uint32_t id) -> void {
+				if (id >= cost.size()) {
+					cost.resize(id + 1, unreached);
+				}
+			}
+		};
+
+		auto checked(std::uint32_t cost) -> std::uint32_t {
+			if (cost == 0) {
+				throw std::invalid_argument("Word costs must be positive.");
+			}
+			return cost;
+		}
+
+		// for_each_neighbour(id, visit) calls visit(neighbour id) for every neighbour, and
+		// cost_of(id) is the cost of stepping onto id. nodes is the number of ids known up front.
+		template<typename ForEachNeighbour, typename CostOf>
+		auto dijkstra(std::uint32_t source,
+		              std::uint32_t target,
+		              std::uint32_t nodes,
+		              ForEachNeighbour const& for_each_neighbour,
+		              CostOf const& cost_of) -> search {
+			auto state = search();
+			state.grow(std::max({source, target, nodes - 1}));
+			auto heap = radix_heap();
+			state.cost[source] = 0;
+			heap.push(0, source);
+			while (!heap.empty()) {
+				auto const [cost, word] = heap.pop();
+				if (cost != state.cost[word]) {
+					continue;
+				}
+				if (word == target) {
+					break;
+				}
+				for_each_neighbour(word, [&](std::uint32_t neighbour) {
+					state.grow(neighbour);
+					auto const through = cost + cost_of(neighbour);
+					if (through < state.cost[neighbour]) {
+						state.cost[neighbour] = through;
+						heap.push(through, neighbour);
+					}
+				});
+			}
+			return state;
+		}
+
+		// walks back from target over the tight edges, those u -> v with cost[u] + cost_of(v) ==
+		// cost[v], and renumbers the words met in spelling order. costs are positive, so any u on
+		// a tight edge costs less than target and was settled before the search stopped; nothing
+		// has to be recorded during the search itself.
+		template<typename ForEachNeighbour, typename CostOf, typename Word>
+		auto cheapest_dag(search const& state,
+		                  std::uint32_t source,
+		                  std::uint32_t target,
+		                  ForEachNeighbour const& for_each_neighbour,
+		                  CostOf const& cost_of,
+		                  Word const& word) -> ladder_dag {
+			auto const& cost = state.cost;
+			if (cost[target] == unreached) {
+				return {};
+			}
+			auto nodes = std::vector<std::uint32_t>{target};
+			auto on_ladder = std::vector<bool>(cost.size(), false);
+			on_ladder[target] = true;
+			auto edges = std::vector<std::pair<std::uint32_t, std::uint32_t>>();
+			for (auto i = std::size_t{0}; i < nodes.size(); ++i) {
+				auto const node = nodes[i];
+				if (node == source) {
+					continue;
+				}
+				auto const step = cost_of(node);
+				for_each_neighbour(node, [&](std::uint32_t neighbour) {
+					if (neighbour < cost.size() && cost[neighbour] < cost[node]
+					    && cost[neighbour] + step == cost[node])
+					{
+						edges.emplace_back(neighbour, node);
+						if (!on_ladder[neighbour]) {
+							on_ladder[neighbour] = true;
+							nodes.push_back(neighbour);
+						}
+					}
+				});
+			}
+			std::sort(nodes.begin(), nodes.end(), [&](std::uint32_t a, std::uint32_t b) {
+				return word(a) < word(b);
+			});
+
+			auto dag = ladder_dag();
+			auto ids = std::vector<std::uint32_t>(cost.size());
+			for (auto id = std::uint32_t{0}; id < nodes.size(); ++id) {
+				ids[nodes[id]] = id;
+				dag.words.emplace_back(word(nodes[id]));
+			}
+			for (auto& [from, to] : edges) {
+				from = ids[from];
+				to = ids[to];
+			}
+			std::sort(edges.begin(), edges.end());
+			dag.offsets.assign(nodes.size() + 1, 0);
+			for (auto const& edge : edges) {
+				++dag.offsets[edge.first + 1];
+				dag.targets.push_back(edge.second);
+			}
+			for (auto i = std::size_t{1}; i < dag.offsets.size(); ++i) {
+				dag.offsets[i] += dag.offsets[i - 1];
+			}
+			dag.source = ids[source];
+			dag.target = ids[target];
+			return dag;
+		}
+	} // namespace
+
+	auto generate_weighted(std::string const& from,
+	                       std::string const& to,
+	                       std::unordered_set<std::string> const& lexicon,
+	                       std::unordered_map<std::string, std::uint32_t> const& costs)
+	   -> std::vector<std::vector<std::string>> {
+		return generate_weighted(from, to, lexicon, position_alphabet(lexicon), costs);
+	}
+
+	// words are numbered as the search first meets them
+	auto generate_weighted(std::string const& from,
+	                       std::string const& to,
+	                       std::unordered_set<std::string> const& lexicon,
+	                       position_alphabet const& alphabet,
+	                       std::unordered_map<std::string, std::uint32_t> const& costs)
+	   -> std::vector<std::vector<std::string>> {
+		if (!lexicon.contains(from) || !lexicon.contains(to) || from.size() != to.size()) {
+			return {};
+		}
+		auto words = std::vector<std::string>{from, to};
+		auto ids = std::unordered_map<std::string, std::uint32_t>{{from, 0}};
+		ids.emplace(to, from == to ? 0 : 1);
+		if (from == to) {
+			words.pop_back();
+		}
+
+		auto const for_each_neighbour = [&](std::uint32_t id, auto const& visit) {
+			auto const word = words[id];
+			auto candidate = word;
+			for (auto i = std::size_t{0}; i < word.size(); ++i) {
+				for (auto letter : alphabet.letters(word.size(), i)) {
+					if (letter == word[i]) {
+						continue;
+					}
+					candidate[i] = letter;
+					if (lexicon.contains(candidate)) {
+						auto const [found, added] =
+						   ids.emplace(candidate, static_cast<std::uint32_t>(words.size()));
+						if (added) {
+							words.push_back(candidate);
+						}
+						visit(found->second);
+					}
+				}
+				candidate[i] = word[i];
+			}
+		};
+		auto const cost_of = [&](std::uint32_t id) {
+			auto const found = costs.find(words[id]);
+			return found == costs.end() ? std::uint32_t{1} : checked(found->second);
+		};
+		auto const target = ids.at(to);
+		auto const state = dijkstra(0, target, 1, for_each_neighbour, cost_of);
+		auto const word = [&](std::uint32_t id) { return std::string_view(words[id]); };
+		return enumerate_ladders(cheapest_dag(state, 0, target, for_each_neighbour, cost_of, word));
+	}
+
+	auto build_weighted_ladder_dag(std::string const& from,
+	                               std::string const& to,
+	                               ladder_graph_view graph,
+	                               std::span<std::uint32_t const> costs) -> ladder_dag {
+		if (costs.size() != graph.size()) {
+			throw std::invalid_argument("Expected one cost per word.");
+		}
+		auto const source = graph.find(from);
+		auto const target = graph.find(to);
+		if (source == ladder_graph_view::npos || target == ladder_graph_view::npos
+		    || from.size() != to.size())
+		{
+			return {};
+		}
+		// the search never leaves the bucket, so it runs on ids local to it
+		auto const [first, last] = graph.bucket(from.size());
+		auto const for_each_neighbour = [graph, first](std::uint32_t id, auto const& visit) {
+			for (auto neighbour : graph.neighbours(first + id)) {
+				visit(neighbour - first);
+			}
+		};
+		auto const cost_of = [costs, first](std::uint32_t id) { return checked(costs[first + id]); };
+		auto const word = [graph, first](std::uint32_t id) { return graph.word(first + id); };
+		auto const state =
+		   dijkstra(source - first, target - first, last - first, for_each_neighbour, cost_of);
+		return cheapest_dag(state, source - first, target - first, for_each_neighbour, cost_of, word);
+	}
+
+	auto generate_weighted(std::string const& from,
+	                       std::string const& to,
+	                       ladder_graph_view graph,
+	                       std::span<std::uint32_t const> costs)
+	   -> std::vector<std::vector<std::string>> {
+		return enumerate_ladders(build_weighted_ladder_dag(from, to, graph, costs));
+	}
+} // namespace word_ladder
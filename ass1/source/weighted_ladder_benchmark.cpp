@@ -0,0 +1,142 @@
+#include <comp6771/command_line.hpp>
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/weighted_ladder.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// times generate_weighted against the unweighted bfs (generate over the same ladder graph) on
+// random same length queries. costs are drawn from a zipf like distribution, as word frequencies
+// are: most words are rare and costly, a few are common and cheap. unit costs are timed as well,
+// to separate the price of the heap from the price of the longer searches weights cause.
+//
+// usage: weighted_ladder_benchmark --lexicon path [--queries n] [--seed n]
+
+namespace {
+	struct timing {
+		double seconds = 0;
+		std::size_t ladders = 0;
+	};
+
+	template<typename Generate>
+	auto run(std::vector<std::pair<std::string, std::string>> const& queries, Generate generate)
+	   -> timing {
+		auto result = timing();
+		auto const start = std::chrono::steady_clock::now();
+		for (auto const& [from, to] : queries) {
+			result.ladders += generate(from, to).size();
+		}
+		result.seconds =
+		   std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return result;
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	auto lexicon_path = std::string();
+	auto query_count = std::size_t{200};
+	auto seed = std::uint64_t{1};
+	auto const args = std::vector<std::string>(argv + 1, argv + argc);
+	for (auto i = std::size_t{0}; i < args.size(); ++i) {
+		auto const has_value = i + 1 < args.size();
+		if (args[i] == "--lexicon" && has_value) {
+			lexicon_path = args[++i];
+		}
+		else if ((args[i] == "--queries" || args[i] == "--seed") && has_value) {
+			auto const count = word_ladder::parse_count("weighted_ladder_benchmark",
+			                                            args[i],
+			                                            args[i + 1]);
+			if (!count) {
+				lexicon_path.clear();
+				break;
+			}
+			if (args[i] == "--queries") {
+				query_count = static_cast<std::size_t>(*count);
+			}
+			else {
+				seed = *count;
+			}
+			++i;
+		}
+		else {
+			lexicon_path.clear();
+			break;
+		}
+	}
+	if (lexicon_path.empty()) {
+		std::cerr << "usage: weighted_ladder_benchmark --lexicon path [--queries n] [--seed n]\n";
+		return 2;
+	}
+
+	auto lexicon = std::unordered_set<std::string>();
+	try {
+		lexicon = word_ladder::read_lexicon(lexicon_path);
+	} catch (std::exception const& e) {
+		std::cerr << "weighted_ladder_benchmark: " << lexicon_path << ": " << e.what() << "\n";
+		return 1;
+	}
+	if (lexicon.empty()) {
+		std::cerr << "weighted_ladder_benchmark: " << lexicon_path << ": no words to query\n";
+		return 1;
+	}
+	auto const owner = word_ladder::ladder_graph(lexicon);
+	auto const graph = owner.view();
+
+	// the word of frequency rank r costs about log2(r), so the cheapest words cost 1
+	auto rng = std::mt19937_64(seed);
+	auto ranks = std::vector<std::uint32_t>(graph.size());
+	for (auto id = std::uint32_t{0}; id < ranks.size(); ++id) {
+		ranks[id] = id;
+	}
+	std::shuffle(ranks.begin(), ranks.end(), rng);
+	auto zipf_costs = std::vector<std::uint32_t>(graph.size());
+	for (auto id = std::size_t{0}; id < ranks.size(); ++id) {
+		zipf_costs[id] = static_cast<std::uint32_t>(std::bit_width(ranks[id] + 1U));
+	}
+	auto const unit_costs = std::vector<std::uint32_t>(graph.size(), 1);
+
+	// queries between words with at least one neighbour, so most of them are connected
+	auto queries = std::vector<std::pair<std::string, std::string>>();
+	auto const max_attempts = query_count * 100;
+	for (auto attempts = std::size_t{0}; queries.size() < query_count && attempts < max_attempts;
+	     ++attempts)
+	{
+		auto const from = static_cast<std::uint32_t>(rng() % graph.size());
+		auto const [first, last] = graph.bucket(graph.word(from).size());
+		// a word alone in its bucket has nothing to ladder to
+		if (last - first < 2) {
+			continue;
+		}
+		auto const to = first + static_cast<std::uint32_t>(rng() % (last - first));
+		if (!graph.neighbours(from).empty() && !graph.neighbours(to).empty()) {
+			queries.emplace_back(graph.word(from), graph.word(to));
+		}
+	}
+
+	auto const bfs = run(queries, [&](auto const& from, auto const& to) {
+		return word_ladder::generate(from, to, graph);
+	});
+	auto const unit = run(queries, [&](auto const& from, auto const& to) {
+		return word_ladder::generate_weighted(from, to, graph, unit_costs);
+	});
+	auto const zipf = run(queries, [&](auto const& from, auto const& to) {
+		return word_ladder::generate_weighted(from, to, graph, zipf_costs);
+	});
+
+	std::cout << "queries: " << queries.size() << "\n"
+	          << "bfs: " << bfs.seconds << " s, " << bfs.ladders << " ladders\n"
+	          << "radix heap dijkstra, unit costs: " << unit.seconds << " s, " << unit.ladders
+	          << " ladders\n"
+	          << "radix heap dijkstra, zipf costs: " << zipf.seconds << " s, " << zipf.ladders
+	          << " ladders\n";
+}
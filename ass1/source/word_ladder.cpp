@@ -1,39 +1,9 @@
+#include <comp6771/position_alphabet.hpp>
 #include <comp6771/word_ladder.hpp>
 
-namespace word_ladder {
-	// takes in a given word and stores an array of words with a single letter difference compared
-	// to the given word and is also present in the lexicon given.
-	// e.g. cat (key) = [cot, oat, cap] (array of values) (just example)
-	auto
-	singleLetterDiff(const std::string& word,
-	                 const std::unordered_set<std::string>& lexicon,
-	                 std::deque<std::string>& single_letter_diff_queue,
-	                 std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map) {
-		std::string temp = word;
-		// temp letter diff words to keep track of words that are single letter diff from source word
-		std::vector<std::string> temp_diff_words;
-		// loop through each char of source word
-		for (int i = 0; i < word.size(); ++i) {
-			// loop through each alphabet per char
-			for (int j = 0; j < 26; ++j) {
-				// change alphabet in char position
-				temp[i] = (char)(int('a') + j);
-				// find single letter diff word in lexicon, if present
-				auto iterated_word = lexicon.find(temp);
-				if (word != temp && iterated_word != lexicon.end()) {
-					// if word found and is not source word,
-					// add word to temp_diff_words array (array of found words that differ by 1 char from
-					// src word) and add to queue
-					temp_diff_words.emplace_back(temp);
-					single_letter_diff_queue.emplace_back(temp);
-				}
-			}
-			// after each char position iteration loop, reset temp to source word for next iteration
-			temp = word;
-		}
-		single_letter_diff_map[word] = temp_diff_words;
-	}
+#include <algorithm>
 
+namespace word_ladder {
 	// bfs that takes the map containing key (word given) and values (single letter diff letters) of
 	// the key then returns unordered map of number of hops from destination word, source word and
 	// single letter diff letters to source word
@@ -83,7 +53,7 @@ namespace word_ladder {
 	         const std::unordered_map<std::string, std::vector<std::string>>& single_letter_diff_map,
 	         const std::unordered_map<std::string, int>& num_hops,
 	         std::vector<std::vector<std::string>>& paths,
-	         std::vector<std::string> curr_path) {
+	         std::vector<std::string> curr_path) -> void {
 		curr_path.emplace_back(src_word);
 		if (src_word == dest_word) {
 			paths.emplace_back(curr_path);
@@ -110,6 +80,15 @@ namespace word_ladder {
 	[[nodiscard]] auto generate(const std::string& from,
 	                            const std::string& to,
 	                            const std::unordered_set<std::string>& lexicon)
+	   -> std::vector<std::vector<std::string>> {
+		return generate(from, to, lexicon, position_alphabet(lexicon));
+	}
+
+	// same as above, substituting only the letters the alphabet has at each position
+	[[nodiscard]] auto generate(const std::string& from,
+	                            const std::string& to,
+	                            const std::unordered_set<std::string>& lexicon,
+	                            const position_alphabet& alphabet)
 	   -> std::vector<std::vector<std::string>> {
 		std::vector<std::string> temp_words;
 		temp_words.emplace_back(from);
@@ -122,6 +101,7 @@ namespace word_ladder {
 				{
 					singleLetterDiff(single_letter_diff_word,
 					                 lexicon,
+					                 alphabet,
 					                 single_letter_diff_queue,
 					                 single_letter_diff_map);
 				}
@@ -0,0 +1,21 @@
+#include <comp6771/command_line.hpp>
+
+#include <cstdint>
+#include <optional>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("counts parse only when the whole value is a non negative number") {
+	CHECK(word_ladder::parse_count("tool", "--threads", "8") == std::uint64_t{8});
+	CHECK(word_ladder::parse_count("tool", "--cache", "0") == std::uint64_t{0});
+	CHECK(word_ladder::parse_count("tool", "--seed", "18446744073709551615")
+	      == std::uint64_t{18446744073709551615ULL});
+	CHECK(word_ladder::parse_count("tool", "--threads", "abc") == std::nullopt);
+	CHECK(word_ladder::parse_count("tool", "--threads", "8x") == std::nullopt);
+	CHECK(word_ladder::parse_count("tool", "--threads", "") == std::nullopt);
+	CHECK(word_ladder::parse_count("tool", "--queries", "-1") == std::nullopt);
+	CHECK(word_ladder::parse_count("tool", "--queries", " -1") == std::nullopt);
+	CHECK(word_ladder::parse_count("tool", "--queries", " 5") == std::nullopt);
+	CHECK(word_ladder::parse_count("tool", "--queries", "+5") == std::nullopt);
+	CHECK(word_ladder::parse_count("tool", "--seed", "18446744073709551616") == std::nullopt);
+}
@@ -0,0 +1,105 @@
+#include <comp6771/deletion_index.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+// brute force reference: every substitution, insertion and deletion of word that is in the lexicon
+auto brute_force_neighbours(std::string const& word, std::unordered_set<std::string> const& lexicon)
+   -> std::vector<std::string> {
+	auto candidates = std::unordered_set<std::string>();
+	for (auto i = std::size_t{0}; i <= word.size(); ++i) {
+		for (auto letter = 'a'; letter <= 'z'; ++letter) {
+			if (i < word.size()) {
+				auto substituted = word;
+				substituted[i] = letter;
+				candidates.insert(substituted);
+			}
+			auto inserted = word;
+			inserted.insert(i, 1, letter);
+			candidates.insert(inserted);
+		}
+		if (i < word.size()) {
+			candidates.insert(word.substr(0, i) + word.substr(i + 1));
+		}
+	}
+	candidates.erase(word);
+	auto result = std::vector<std::string>();
+	std::copy_if(candidates.begin(),
+	             candidates.end(),
+	             std::back_inserter(result),
+	             [&](auto const& candidate) { return lexicon.contains(candidate); });
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+TEST_CASE("single edit check") {
+	CHECK(word_ladder::is_single_edit("abc", "abd"));
+	CHECK(word_ladder::is_single_edit("abc", "ab"));
+	CHECK(word_ladder::is_single_edit("ac", "abc"));
+	CHECK(word_ladder::is_single_edit("", "a"));
+	// transpositions share deletion keys but are two edits apart
+	CHECK(!word_ladder::is_single_edit("ab", "ba"));
+	CHECK(!word_ladder::is_single_edit("abc", "abc"));
+	CHECK(!word_ladder::is_single_edit("abc", "a"));
+}
+
+TEST_CASE("deletion index neighbours (small lexicon)") {
+	auto const lexicon =
+	   std::unordered_set<std::string>{"at", "cat", "cot", "coat", "chat", "cart", "cats", "dog"};
+	auto const index = word_ladder::deletion_index(lexicon);
+	CHECK(index.size() == lexicon.size());
+	CHECK(index.contains("coat"));
+	CHECK(!index.contains("oat"));
+	CHECK(index.neighbours("cat")
+	      == std::vector<std::string>{"at", "cart", "cats", "chat", "coat", "cot"});
+	CHECK(index.neighbours("dog").empty());
+	// words outside the lexicon can still be queried
+	CHECK(index.neighbours("ca") == std::vector<std::string>{"cat"});
+}
+
+TEST_CASE("extended ladders (small lexicon)") {
+	auto const lexicon =
+	   std::unordered_set<std::string>{"at", "cat", "cot", "coat", "chat", "cart", "cats", "dog"};
+
+	SECTION("ladder that changes length") {
+		auto const ladders = word_ladder::generate_extended("at", "coat", lexicon);
+		CHECK(ladders == std::vector<std::vector<std::string>>{{"at", "cat", "coat"}});
+	}
+
+	SECTION("multiple ladders mixing deletion and substitution") {
+		auto const ladders = word_ladder::generate_extended("chat", "cot", lexicon);
+		CHECK(ladders
+		      == std::vector<std::vector<std::string>>{{"chat", "cat", "cot"},
+		                                               {"chat", "coat", "cot"}});
+	}
+
+	SECTION("no ladder") {
+		CHECK(word_ladder::generate_extended("dog", "cat", lexicon).empty());
+	}
+}
+
+TEST_CASE("deletion index agrees with brute force mutation (english)") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	auto const index = word_ladder::deletion_index(english_lexicon);
+	for (auto const* word : {"a", "cat", "work", "play", "atlases", "cabaret", "aardvark"}) {
+		CHECK(index.neighbours(word) == brute_force_neighbours(word, english_lexicon));
+	}
+
+	// extended ladders are never longer than substitution-only ladders
+	auto const ladders = word_ladder::generate_extended("work", "play", index);
+	REQUIRE(!ladders.empty());
+	CHECK(std::is_sorted(ladders.begin(), ladders.end()));
+	CHECK(ladders.front().size() <= 7);
+	for (auto const& ladder : ladders) {
+		CHECK(ladder.front() == "work");
+		CHECK(ladder.back() == "play");
+		for (auto i = std::size_t{1}; i < ladder.size(); ++i) {
+			CHECK(word_ladder::is_single_edit(ladder[i - 1], ladder[i]));
+		}
+	}
+}
@@ -0,0 +1,157 @@
+#include <comp6771/distance_labels.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "english_words.hpp"
+
+// english words of up to four letters
+auto short_english() -> english_slice const& {
+	return english_words<1, 4>();
+}
+
+// labelled once and shared by the test cases below
+auto short_english_labels() -> word_ladder::distance_labels const& {
+	static auto const shared = word_ladder::distance_labels(short_english().graph);
+	return shared;
+}
+
+// plain bfs distances from source to every word of its bucket
+auto bfs_distances(word_ladder::ladder_graph_view graph, word_ladder::ladder_graph_view::id_type source)
+   -> std::vector<std::optional<int>> {
+	auto distances = std::vector<std::optional<int>>(graph.size());
+	auto queue = std::vector<word_ladder::ladder_graph_view::id_type>{source};
+	distances[source] = 0;
+	for (auto i = std::size_t{0}; i < queue.size(); ++i) {
+		for (auto neighbour : graph.neighbours(queue[i])) {
+			if (!distances[neighbour]) {
+				distances[neighbour] = *distances[queue[i]] + 1;
+				queue.push_back(neighbour);
+			}
+		}
+	}
+	return distances;
+}
+
+TEST_CASE("labelled distances match bfs over whole buckets") {
+	auto const& [lexicon, graph] = short_english();
+	auto const& labels = short_english_labels();
+	for (auto const* word : {"at", "cat", "work", "play", "zoo"}) {
+		auto const source = graph.view().find(word);
+		REQUIRE(source != word_ladder::ladder_graph_view::npos);
+		auto const expected = bfs_distances(graph, source);
+		auto const [first, last] = graph.view().bucket(std::string(word).size());
+		auto mismatches = 0;
+		for (auto id = first; id < last; ++id) {
+			mismatches += labels.distance(source, id) == expected[id] ? 0 : 1;
+		}
+		CHECK(mismatches == 0);
+	}
+}
+
+TEST_CASE("labelled distances by spelling") {
+	auto const& [lexicon, graph] = short_english();
+	auto const& labels = short_english_labels();
+	CHECK(labels.distance("work", "play") == 6);
+	CHECK(labels.distance("play", "work") == 6);
+	CHECK(labels.distance("work", "work") == 0);
+	CHECK(labels.distance("work", "cat") == std::nullopt);
+	CHECK(labels.distance("work", "notaword") == std::nullopt);
+	CHECK(labels.label_entries() >= graph.view().size());
+}
+
+TEST_CASE("persisted label file") {
+	auto const& [lexicon, graph] = short_english();
+	auto const& labels = short_english_labels();
+	auto const path = std::string("distance_labels_test.labels");
+	labels.save(path);
+	auto const loaded = word_ladder::distance_labels::load(path, graph);
+	CHECK(loaded.label_entries() == labels.label_entries());
+	CHECK(loaded.distance("work", "play") == 6);
+	CHECK(loaded.distance("cold", "warm") == labels.distance("cold", "warm"));
+
+	auto const other_graph =
+	   word_ladder::ladder_graph(word_ladder::read_lexicon("../../test/word_ladder/english_test.txt"));
+	CHECK_THROWS_AS(word_ladder::distance_labels::load(path, other_graph), std::runtime_error);
+	// same words and edges, other ids
+	auto const renumbered = word_ladder::ladder_graph(lexicon, word_ladder::graph_order::degree);
+	CHECK(renumbered.view().size() == graph.view().size());
+	CHECK(renumbered.view().edge_count() == graph.view().edge_count());
+	CHECK_THROWS_WITH(word_ladder::distance_labels::load(path, renumbered),
+	                  "Distance labels were built for a different graph.");
+	std::remove(path.c_str());
+}
+
+TEST_CASE("corrupt label files are rejected") {
+	auto const& [lexicon, graph] = short_english();
+	auto const path = std::string("distance_labels_corrupt_test.labels");
+	short_english_labels().save(path);
+	auto const read_file = [&] {
+		auto in = std::ifstream(path, std::ios::binary | std::ios::ate);
+		auto bytes = std::string(static_cast<std::size_t>(in.tellg()), '\0');
+		in.seekg(0);
+		in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+		return bytes;
+	};
+	auto const saved = read_file();
+	auto const write_file = [&](std::string const& bytes) {
+		auto out = std::ofstream(path, std::ios::binary);
+		out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	};
+	// overwrites the uint64 at byte offset with value
+	auto const patched = [&](std::size_t offset, std::uint64_t value) {
+		auto bytes = saved;
+		std::memcpy(bytes.data() + offset, &value, sizeof(value));
+		return bytes;
+	};
+	// magic, then word count, edge count and entry count, then the fingerprint and the offsets
+	constexpr auto entry_count = std::size_t{8 + 16};
+	constexpr auto offsets = std::size_t{8 + 32};
+	auto const last_offset = offsets + graph.view().size() * sizeof(std::uint64_t);
+
+	auto const corruptions = std::vector<std::string>{
+	   saved + '\0',
+	   saved.substr(0, saved.size() - 1),
+	   patched(entry_count, std::uint64_t{1} << 60),
+	   patched(offsets, 1),
+	   patched(offsets + sizeof(std::uint64_t), std::uint64_t{1} << 40),
+	   patched(last_offset, 0),
+	};
+	for (auto const& bytes : corruptions) {
+		write_file(bytes);
+		CHECK_THROWS_WITH(word_ladder::distance_labels::load(path, graph),
+		                  "Not a distance label file.");
+	}
+	write_file(saved);
+	CHECK(word_ladder::distance_labels::load(path, graph).distance("work", "play") == 6);
+	std::remove(path.c_str());
+}
+
+TEST_CASE("ladders fall back to generate") {
+	auto const& [lexicon, graph] = short_english();
+	auto const& labels = short_english_labels();
+	CHECK(labels.ladders("work", "play") == word_ladder::generate("work", "play", lexicon));
+}
+
+TEST_CASE("single threaded build and unconnected words") {
+	auto const test_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english_test.txt");
+	auto const graph = word_ladder::ladder_graph(test_lexicon);
+	auto const labels = word_ladder::distance_labels(graph, 1);
+	CHECK(labels.distance("hansel", "gretel") == std::nullopt);
+	CHECK(labels.ladders("hansel", "gretel").empty());
+	CHECK(labels.distance("aaa", "bbb") == 3);
+	CHECK(labels.distance("aaaaa", "baaae") == 2);
+	CHECK(word_ladder::distance_labels(graph, 4).label_entries() == labels.label_entries());
+}
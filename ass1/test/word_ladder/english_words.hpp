@@ -0,0 +1,34 @@
+#ifndef COMP6771_TEST_WORD_LADDER_ENGLISH_WORDS_HPP
+#define COMP6771_TEST_WORD_LADDER_ENGLISH_WORDS_HPP
+
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+// a slice of english.txt and its ladder graph. tests over real words use a slice so that they stay
+// quick in debug builds.
+struct english_slice {
+	std::unordered_set<std::string> lexicon;
+	word_ladder::ladder_graph graph;
+};
+
+// the english words of MinLength to MaxLength letters, read and built once per test binary and
+// shared by its test cases
+template<std::size_t MinLength, std::size_t MaxLength>
+auto english_words() -> english_slice const& {
+	static auto const shared = [] {
+		auto words = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+		std::erase_if(words, [](auto const& word) {
+			return word.size() < MinLength || word.size() > MaxLength;
+		});
+		auto graph = word_ladder::ladder_graph(words);
+		return english_slice{std::move(words), std::move(graph)};
+	}();
+	return shared;
+}
+
+#endif // COMP6771_TEST_WORD_LADDER_ENGLISH_WORDS_HPP
@@ -0,0 +1,94 @@
+#include <comp6771/front_coded_lexicon.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+// reference wildcard match against the hash set lexicon
+auto brute_force_match(std::unordered_set<std::string> const& lexicon,
+                       std::string const& pattern,
+                       std::size_t wildcard) -> std::vector<std::string> {
+	auto result = std::vector<std::string>();
+	for (auto const& word : lexicon) {
+		if (word.size() == pattern.size() && word.compare(0, wildcard, pattern, 0, wildcard) == 0
+		    && word.compare(wildcard + 1, std::string::npos, pattern, wildcard + 1) == 0)
+		{
+			result.push_back(word);
+		}
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+TEST_CASE("front coded lexicon (english)") {
+	auto const path = std::string("../../test/word_ladder/english.txt");
+	auto const english_lexicon = word_ladder::read_lexicon(path);
+	auto const compact = word_ladder::read_front_coded_lexicon(path);
+
+	SECTION("membership") {
+		CHECK(compact.size() == english_lexicon.size());
+		CHECK(std::all_of(english_lexicon.begin(), english_lexicon.end(), [&](auto const& word) {
+			return compact.contains(word);
+		}));
+		for (auto const* word : {"", "aaaaaaaaaaaaaaaa", "zzzzzzz", "workk", "wor", "plau"}) {
+			CHECK(!compact.contains(word));
+		}
+		auto const words = compact.words();
+		CHECK(std::is_sorted(words.begin(), words.end()));
+		CHECK(std::unordered_set<std::string>(words.begin(), words.end()) == english_lexicon);
+	}
+
+	SECTION("smaller than the word list itself") {
+		CHECK(compact.memory_usage() < std::filesystem::file_size(path));
+	}
+
+	SECTION("single wildcard matches") {
+		for (auto const* pattern : {"work", "play", "cat", "atlases", "zebra", "a"}) {
+			auto const word = std::string(pattern);
+			for (auto wildcard = std::size_t{0}; wildcard < word.size(); ++wildcard) {
+				CHECK(compact.match(word, wildcard) == brute_force_match(english_lexicon, word, wildcard));
+			}
+		}
+		CHECK(compact.match("cat", 3).empty());
+	}
+
+	SECTION("generate gives the same ladders") {
+		CHECK(word_ladder::generate("work", "play", compact)
+		      == word_ladder::generate("work", "play", english_lexicon));
+		CHECK(word_ladder::generate("code", "data", compact)
+		      == word_ladder::generate("code", "data", english_lexicon));
+	}
+}
+
+TEST_CASE("front coded lexicon (small)") {
+	auto const test_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english_test.txt");
+	auto const compact = word_ladder::front_coded_lexicon(test_lexicon);
+	CHECK(compact.size() == test_lexicon.size());
+	CHECK(word_ladder::generate("aaaa", "abba", compact)
+	      == word_ladder::generate("aaaa", "abba", test_lexicon));
+	CHECK(word_ladder::generate("hansel", "gretel", compact).empty());
+
+	auto const empty = word_ladder::front_coded_lexicon();
+	CHECK(!empty.contains("a"));
+	CHECK(empty.match("abc", 1).empty());
+}
+
+TEST_CASE("front coded lexicons merge without duplicates") {
+	auto const first = word_ladder::front_coded_lexicon(std::vector<std::string>{
+	   "work", "play", "cat", "work", "atlases"});
+	auto const second = word_ladder::front_coded_lexicon(std::vector<std::string>{
+	   "dog", "cat", "zebra", "a", "play"});
+	auto const merged = word_ladder::front_coded_lexicon::merge(
+	   {first, second, word_ladder::front_coded_lexicon()});
+	CHECK(merged.words()
+	      == std::vector<std::string>{"a", "atlases", "cat", "dog", "play", "work", "zebra"});
+	CHECK(merged.size() == 7);
+	CHECK(merged.contains("dog"));
+	CHECK(merged.match("cot", 1) == std::vector<std::string>{"cat"});
+	CHECK(word_ladder::front_coded_lexicon::merge({}).size() == 0);
+}
@@ -0,0 +1,117 @@
+#include <comp6771/ladder_cache.hpp>
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("shortest path dag matches generate") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+
+	SECTION("forwards and reversed (work->play)") {
+		auto const dag = word_ladder::build_ladder_dag("work", "play", english_lexicon);
+		CHECK(word_ladder::enumerate_ladders(dag)
+		      == word_ladder::generate("work", "play", english_lexicon));
+		CHECK(word_ladder::enumerate_ladders(word_ladder::reverse(dag))
+		      == word_ladder::generate("play", "work", english_lexicon));
+		// only words on some shortest ladder are kept
+		CHECK(dag.words.size() < 40);
+	}
+
+	SECTION("no ladder gives an empty dag (hansel->gretel)") {
+		auto const test_lexicon =
+		   word_ladder::read_lexicon("../../test/word_ladder/english_test.txt");
+		auto const dag = word_ladder::build_ladder_dag("hansel", "gretel", test_lexicon);
+		CHECK(dag.empty());
+		CHECK(word_ladder::enumerate_ladders(dag).empty());
+		CHECK(word_ladder::reverse(dag).empty());
+	}
+}
+
+TEST_CASE("ladder cache") {
+	auto const test_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english_test.txt");
+	auto const alphabet = word_ladder::position_alphabet(test_lexicon);
+
+	SECTION("repeated and mirrored queries are hits") {
+		auto cache = word_ladder::ladder_cache(8, 2);
+		auto const ladders = cache.generate("aaaa", "abba", test_lexicon, alphabet);
+		CHECK(ladders == word_ladder::generate("aaaa", "abba", test_lexicon));
+		CHECK(cache.misses() == 1);
+		CHECK(cache.hits() == 0);
+
+		CHECK(cache.generate("aaaa", "abba", test_lexicon, alphabet) == ladders);
+		CHECK(cache.generate("abba", "aaaa", test_lexicon, alphabet)
+		      == word_ladder::generate("abba", "aaaa", test_lexicon));
+		CHECK(cache.hits() == 2);
+		CHECK(cache.misses() == 1);
+		CHECK(cache.size() == 1);
+	}
+
+	SECTION("least recently used entry is evicted") {
+		auto cache = word_ladder::ladder_cache(2, 1);
+		CHECK(cache.capacity() == 2);
+		CHECK(!cache.generate("aaa", "bbb", test_lexicon, alphabet).empty());
+		CHECK(!cache.generate("aaaa", "abba", test_lexicon, alphabet).empty());
+		CHECK(cache.find("aaa", "bbb") != nullptr);
+		CHECK(!cache.generate("aaaaa", "baaae", test_lexicon, alphabet).empty());
+		CHECK(cache.size() == 2);
+		CHECK(cache.find("aaaa", "abba") == nullptr);
+		CHECK(cache.find("bbb", "aaa") != nullptr);
+	}
+
+	SECTION("capacity is what was asked for, however many shards") {
+		CHECK(word_ladder::ladder_cache(1).capacity() == 1);
+		CHECK(word_ladder::ladder_cache(5, 2).capacity() == 5);
+		CHECK(word_ladder::ladder_cache(20).capacity() == 20);
+		CHECK(word_ladder::ladder_cache(0).capacity() == 0);
+
+		// one shard of one dag, not 16
+		auto single = word_ladder::ladder_cache(1);
+		CHECK(!single.generate("aaa", "bbb", test_lexicon, alphabet).empty());
+		CHECK(!single.generate("aaaa", "abba", test_lexicon, alphabet).empty());
+		CHECK(single.size() == 1);
+		CHECK(single.find("aaaa", "abba") != nullptr);
+
+		auto none = word_ladder::ladder_cache(0);
+		CHECK(!none.generate("aaa", "bbb", test_lexicon, alphabet).empty());
+		CHECK(none.size() == 0);
+	}
+
+	SECTION("invalidate drops every entry") {
+		auto cache = word_ladder::ladder_cache(8);
+		CHECK(!cache.generate("aaa", "bbb", test_lexicon, alphabet).empty());
+		cache.invalidate();
+		CHECK(cache.size() == 0);
+		CHECK(cache.find("aaa", "bbb") == nullptr);
+
+		auto changed_lexicon = test_lexicon;
+		changed_lexicon.erase("abb");
+		auto const changed_alphabet = word_ladder::position_alphabet(changed_lexicon);
+		CHECK(cache.generate("aaa", "bbb", changed_lexicon, changed_alphabet).empty());
+	}
+
+	SECTION("shared between threads") {
+		auto cache = word_ladder::ladder_cache(4, 4);
+		auto const expected = word_ladder::generate("aaaa", "abba", test_lexicon);
+		auto results = std::vector<std::vector<std::vector<std::string>>>(8);
+		{
+			auto threads = std::vector<std::jthread>();
+			for (auto& result : results) {
+				threads.emplace_back([&] {
+					for (auto i = 0; i < 50; ++i) {
+						result = i % 2 == 0
+						            ? cache.generate("aaaa", "abba", test_lexicon, alphabet)
+						            : cache.generate("abba", "aaaa", test_lexicon, alphabet);
+					}
+				});
+			}
+		}
+		for (auto const& result : results) {
+			CHECK(result.size() == expected.size());
+		}
+		CHECK(cache.hits() + cache.misses() == 400);
+	}
+}
@@ -0,0 +1,95 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/position_alphabet.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("ladder graph matches singleLetterDiff") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	auto const owner = word_ladder::ladder_graph(english_lexicon);
+	auto const graph = owner.view();
+	auto const alphabet = word_ladder::position_alphabet(english_lexicon);
+
+	CHECK(graph.size() == english_lexicon.size());
+	CHECK(graph.find("notaword") == word_ladder::ladder_graph_view::npos);
+
+	for (auto const* word : {"at", "cat", "work", "play", "atlases", "cabaret"}) {
+		auto const id = graph.find(word);
+		REQUIRE(id != word_ladder::ladder_graph_view::npos);
+		CHECK(graph.word(id) == word);
+
+		auto const [first, last] = graph.bucket(std::string(word).size());
+		CHECK(first <= id);
+		CHECK(id < last);
+
+		auto queue = std::deque<std::string>();
+		auto map = std::unordered_map<std::string, std::vector<std::string>>();
+		word_ladder::singleLetterDiff(word, english_lexicon, alphabet, queue, map);
+		auto expected = map[word];
+		std::sort(expected.begin(), expected.end());
+		auto actual = std::vector<std::string>();
+		for (auto neighbour : graph.neighbours(id)) {
+			CHECK(graph.word(neighbour).size() == std::string(word).size());
+			actual.emplace_back(graph.word(neighbour));
+		}
+		std::sort(actual.begin(), actual.end());
+		CHECK(actual == expected);
+	}
+}
+
+TEST_CASE("empty ladder graph") {
+	auto const owner = word_ladder::ladder_graph(std::unordered_set<std::string>{});
+	auto const graph = owner.view();
+	CHECK(graph.size() == 0);
+	CHECK(graph.find("a") == word_ladder::ladder_graph_view::npos);
+}
+
+TEST_CASE("reordered ladder graphs are the same graph") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	auto lexicon = std::unordered_set<std::string>();
+	for (auto const& word : english_lexicon) {
+		if (word.size() <= 4) {
+			lexicon.insert(word);
+		}
+	}
+	auto const reference_owner = word_ladder::ladder_graph(lexicon);
+	auto const reference = reference_owner.view();
+
+	for (auto const order : {word_ladder::graph_order::bfs,
+	                         word_ladder::graph_order::reverse_cuthill_mckee,
+	                         word_ladder::graph_order::degree}) {
+		auto const owner = word_ladder::ladder_graph(lexicon, order);
+		auto const graph = owner.view();
+		REQUIRE(graph.size() == reference.size());
+		CHECK(graph.edge_count() == reference.edge_count());
+		for (auto id = word_ladder::ladder_graph_view::id_type{0}; id < graph.size(); ++id) {
+			auto const word = graph.word(id);
+			REQUIRE(graph.find(word) == id);
+			auto const [first, last] = graph.bucket(word.size());
+			CHECK(first <= id);
+			CHECK(id < last);
+
+			auto actual = std::vector<std::string_view>();
+			for (auto neighbour : graph.neighbours(id)) {
+				actual.push_back(graph.word(neighbour));
+			}
+			auto expected = std::vector<std::string_view>();
+			for (auto neighbour : reference.neighbours(reference.find(word))) {
+				expected.push_back(reference.word(neighbour));
+			}
+			std::sort(actual.begin(), actual.end());
+			REQUIRE(actual == expected);
+		}
+		CHECK(word_ladder::generate("work", "play", graph)
+		      == word_ladder::generate("work", "play", lexicon));
+	}
+}
@@ -0,0 +1,176 @@
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/ladder_pairs.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "english_words.hpp"
+
+// three letter english words
+auto three_letter_english() -> english_slice const& {
+	return english_words<3, 3>();
+}
+
+// plain bfs from source, with the number of shortest ladders to each word of its bucket
+auto bfs_ladder_counts(word_ladder::ladder_graph_view graph,
+                       word_ladder::ladder_graph_view::id_type source)
+   -> std::vector<std::pair<int, std::uint64_t>> {
+	auto counts = std::vector<std::pair<int, std::uint64_t>>(graph.size(), {-1, 0});
+	auto queue = std::vector<word_ladder::ladder_graph_view::id_type>{source};
+	counts[source] = {0, 1};
+	for (auto i = std::size_t{0}; i < queue.size(); ++i) {
+		auto const [depth, ladders] = counts[queue[i]];
+		for (auto neighbour : graph.neighbours(queue[i])) {
+			if (counts[neighbour].first == -1) {
+				counts[neighbour].first = depth + 1;
+				queue.push_back(neighbour);
+			}
+			if (counts[neighbour].first == depth + 1) {
+				counts[neighbour].second += ladders;
+			}
+		}
+	}
+	return counts;
+}
+
+TEST_CASE("pairs have exactly the requested distance and few enough ladders") {
+	auto const& english = three_letter_english();
+	auto const graph = english.graph.view();
+	auto const options = word_ladder::ladder_pair_options{
+	   .distance = 3,
+	   .max_ladders = 2,
+	   .sources = 5,
+	   .seed = 6771,
+	   .threads = 2,
+	};
+	auto const pairs = word_ladder::find_ladder_pairs(graph, options);
+	REQUIRE(pairs.size() > 10);
+	for (auto i = std::size_t{0}; i < pairs.size(); i += pairs.size() / 10) {
+		auto const ladders = word_ladder::generate(std::string(graph.word(pairs[i].from)),
+		                                           std::string(graph.word(pairs[i].to)),
+		                                           english.lexicon);
+		REQUIRE(ladders.size() == pairs[i].ladders);
+		CHECK(pairs[i].ladders <= 2);
+		CHECK(ladders.front().size() == 4);
+	}
+}
+
+TEST_CASE("every qualifying word of a source is paired with it") {
+	auto const graph = three_letter_english().graph.view();
+	auto const options = word_ladder::ladder_pair_options{
+	   .distance = 2,
+	   .max_ladders = 3,
+	   .sources = 20,
+	   .seed = 42,
+	   .threads = 1,
+	};
+	auto const pairs = word_ladder::find_ladder_pairs(graph, options);
+	auto sources = std::set<word_ladder::ladder_graph_view::id_type>();
+	for (auto const& pair : pairs) {
+		sources.insert(pair.from);
+	}
+	CHECK(sources.size() > 10);
+	for (auto const source : sources) {
+		auto const counts = bfs_ladder_counts(graph, source);
+		auto expected = std::vector<word_ladder::ladder_pair>();
+		for (auto to = word_ladder::ladder_graph_view::id_type{0}; to < graph.size(); ++to) {
+			if (counts[to].first == 2 && counts[to].second <= 3) {
+				expected.push_back({source, to, counts[to].second});
+			}
+		}
+		auto found = std::vector<word_ladder::ladder_pair>();
+		std::copy_if(pairs.begin(), pairs.end(), std::back_inserter(found), [&](auto const& pair) {
+			return pair.from == source;
+		});
+		CHECK(found == expected);
+	}
+}
+
+TEST_CASE("the same seed finds the same pairs on any number of threads") {
+	auto const graph = three_letter_english().graph.view();
+	auto options = word_ladder::ladder_pair_options{.distance = 4, .max_ladders = 1, .sources = 40};
+	options.threads = 1;
+	auto const serial = word_ladder::find_ladder_pairs(graph, options);
+	options.threads = 4;
+	CHECK(word_ladder::find_ladder_pairs(graph, options) == serial);
+
+	// streamed batches come one source at a time, in ascending "to" order
+	auto streamed = std::size_t{0};
+	auto const check_batch = [&](std::span<word_ladder::ladder_pair const> batch) {
+		CHECK(std::all_of(batch.begin(), batch.end(), [&](auto const& pair) {
+			return pair.from == batch.front().from;
+		}));
+		CHECK(std::is_sorted(batch.begin(), batch.end(), [](auto const& a, auto const& b) {
+			return a.to < b.to;
+		}));
+		streamed += batch.size();
+	};
+	word_ladder::find_ladder_pairs(graph, options, check_batch);
+	CHECK(streamed == serial.size());
+}
+
+TEST_CASE("the largest max_ladders means no limit") {
+	auto const graph = three_letter_english().graph.view();
+	auto options = word_ladder::ladder_pair_options{
+	   .distance = 2,
+	   .max_ladders = std::numeric_limits<std::uint64_t>::max(),
+	   .sources = 20,
+	   .seed = 42,
+	   .threads = 2,
+	};
+	auto const unlimited = word_ladder::find_ladder_pairs(graph, options);
+	REQUIRE(!unlimited.empty());
+	CHECK(std::all_of(unlimited.begin(), unlimited.end(), [](auto const& pair) {
+		return pair.ladders > 0;
+	}));
+	options.max_ladders = 1'000'000;
+	CHECK(word_ladder::find_ladder_pairs(graph, options) == unlimited);
+}
+
+TEST_CASE("an exception from the sink reaches the caller") {
+	auto const graph = three_letter_english().graph.view();
+	auto const options = word_ladder::ladder_pair_options{
+	   .distance = 2,
+	   .max_ladders = 3,
+	   .sources = 100,
+	   .threads = 4,
+	};
+	auto calls = 0;
+	auto const full = [&](std::span<word_ladder::ladder_pair const>) {
+		++calls;
+		throw std::runtime_error("sink is full");
+	};
+	CHECK_THROWS_WITH(word_ladder::find_ladder_pairs(graph, options, full), "sink is full");
+	CHECK(calls == 1);
+}
+
+TEST_CASE("sources can be limited to one length") {
+	auto lexicon = std::unordered_set<std::string>{"cat", "cot", "cog", "dog", "at", "it", "in"};
+	auto const owner = word_ladder::ladder_graph(lexicon);
+	auto const graph = owner.view();
+	auto options = word_ladder::ladder_pair_options{.distance = 2, .max_ladders = 1, .length = 2};
+	auto const pairs = word_ladder::find_ladder_pairs(graph, options);
+	REQUIRE(pairs.size() == 2);
+	CHECK(graph.word(pairs[0].from) == "at");
+	CHECK(graph.word(pairs[0].to) == "in");
+	CHECK(graph.word(pairs[1].from) == "in");
+	CHECK(graph.word(pairs[1].to) == "at");
+
+	options.length = 7;
+	CHECK(word_ladder::find_ladder_pairs(graph, options).empty());
+	options.length = 0;
+	options.distance = 0;
+	CHECK(word_ladder::find_ladder_pairs(graph, options).size() == lexicon.size());
+}
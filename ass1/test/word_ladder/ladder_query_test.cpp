@@ -0,0 +1,104 @@
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/ladder_query.hpp>
+#include <comp6771/stop_check.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <chrono>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+#include <catch2/catch.hpp>
+
+// read once and shared by the test cases below
+auto english() -> std::unordered_set<std::string> const& {
+	static auto const lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	return lexicon;
+}
+
+TEST_CASE("a stop_check only stops once asked to") {
+	auto never = word_ladder::stop_check();
+	for (auto i = 0; i < 10'000; ++i) {
+		never.poll();
+	}
+
+	auto source = std::stop_source();
+	auto stop = word_ladder::stop_check(source.get_token());
+	stop.poll();
+	source.request_stop();
+	// noticed within one interval of polls
+	auto const noticed = [&] {
+		try {
+			for (auto i = 0U; i < word_ladder::stop_check::interval; ++i) {
+				stop.poll();
+			}
+		} catch (word_ladder::ladder_query_stopped const& stopped) {
+			return !stopped.deadline_passed();
+		}
+		return false;
+	};
+	CHECK(noticed());
+
+	auto late = word_ladder::stop_check({}, word_ladder::stop_check::clock::now());
+	CHECK_THROWS_MATCHES(late.poll(),
+	                     word_ladder::ladder_query_stopped,
+	                     Catch::Matchers::Message("Ladder query missed its deadline."));
+}
+
+TEST_CASE("async queries give generate's ladders") {
+	auto const& english_lexicon = english();
+	auto const graph = word_ladder::ladder_graph(english_lexicon);
+	auto const alphabet = word_ladder::position_alphabet(english_lexicon);
+	auto const deadline = word_ladder::stop_check::clock::now() + std::chrono::minutes(10);
+	for (auto const& [from, to] : {std::pair("work", "play"), std::pair("cat", "dog")}) {
+		auto by_lexicon = word_ladder::generate_async(from, to, english_lexicon, {}, deadline);
+		auto by_alphabet =
+		   word_ladder::generate_async(from, to, english_lexicon, alphabet, {}, deadline);
+		auto by_graph = word_ladder::generate_async(from, to, graph.view());
+		auto const expected = word_ladder::generate(from, to, english_lexicon);
+		CHECK(by_lexicon.get() == expected);
+		CHECK(by_alphabet.get() == expected);
+		CHECK(by_graph.get() == expected);
+	}
+	auto missing = word_ladder::generate_async("cat", "zzz", graph.view());
+	CHECK(missing.get().empty());
+}
+
+TEST_CASE("stopped queries end early") {
+	auto const& english_lexicon = english();
+
+	SECTION("stop requested before the query starts") {
+		auto source = std::stop_source();
+		source.request_stop();
+		auto query = word_ladder::generate_async("work", "play", english_lexicon, source.get_token());
+		CHECK_THROWS_MATCHES(query.get(),
+		                     word_ladder::ladder_query_stopped,
+		                     Catch::Matchers::Message("Ladder query was stopped."));
+	}
+
+	SECTION("deadline already passed") {
+		auto const deadline = word_ladder::stop_check::clock::now();
+		auto query = word_ladder::generate_async("work", "play", english_lexicon, {}, deadline);
+		CHECK_THROWS_AS(query.get(), word_ladder::ladder_query_stopped);
+	}
+
+	SECTION("stop requested while the search runs") {
+		// this long ladder takes seconds to search, far longer than the wait below
+		auto source = std::stop_source();
+		auto query =
+		   word_ladder::generate_async("atlases", "cabaret", english_lexicon, source.get_token());
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		source.request_stop();
+		CHECK_THROWS_AS(query.get(), word_ladder::ladder_query_stopped);
+	}
+
+	SECTION("search outlives its deadline") {
+		auto const deadline = word_ladder::stop_check::clock::now() + std::chrono::milliseconds(20);
+		auto stop = word_ladder::stop_check({}, deadline);
+		auto const started = word_ladder::stop_check::clock::now();
+		CHECK_THROWS_AS(word_ladder::generate("atlases", "cabaret", english_lexicon, stop),
+		                word_ladder::ladder_query_stopped);
+		CHECK(word_ladder::stop_check::clock::now() - started < std::chrono::seconds(2));
+	}
+}
@@ -0,0 +1,59 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_sampler.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("uniform sampling of shortest ladders") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	auto const all_ladders = word_ladder::generate("work", "play", english_lexicon);
+	auto const sampler =
+	   word_ladder::ladder_sampler(word_ladder::build_ladder_dag("work", "play", english_lexicon));
+
+	SECTION("count matches enumeration") {
+		CHECK(sampler.count() == static_cast<double>(all_ladders.size()));
+	}
+
+	SECTION("every sample is a shortest ladder") {
+		for (auto const& ladder : sampler.sample(200, 6771)) {
+			CHECK(std::binary_search(all_ladders.begin(), all_ladders.end(), ladder));
+		}
+	}
+
+	SECTION("the same seed reproduces the same samples") {
+		CHECK(sampler.sample(50, 42) == sampler.sample(50, 42));
+		CHECK(sampler.sample(50, 42) != sampler.sample(50, 43));
+		CHECK(word_ladder::sample_ladders("work", "play", english_lexicon, 50, 42)
+		      == sampler.sample(50, 42));
+		auto const alphabet = word_ladder::position_alphabet(english_lexicon);
+		CHECK(word_ladder::sample_ladders("work", "play", english_lexicon, alphabet, 50, 42)
+		      == sampler.sample(50, 42));
+	}
+
+	SECTION("samples are spread evenly over all ladders") {
+		auto const draws = all_ladders.size() * 1000;
+		auto counts = std::map<std::vector<std::string>, std::size_t>();
+		for (auto const& ladder : sampler.sample(draws, 1)) {
+			++counts[ladder];
+		}
+		CHECK(counts.size() == all_ladders.size());
+		for (auto const& [ladder, count] : counts) {
+			// expected 1000 per ladder, standard deviation about 30
+			CHECK(count > 850);
+			CHECK(count < 1150);
+		}
+	}
+}
+
+TEST_CASE("sampling with no ladder") {
+	auto const test_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english_test.txt");
+	auto const sampler =
+	   word_ladder::ladder_sampler(word_ladder::build_ladder_dag("hansel", "gretel", test_lexicon));
+	CHECK(sampler.count() == 0);
+	CHECK(sampler.sample(5, 0).empty());
+}
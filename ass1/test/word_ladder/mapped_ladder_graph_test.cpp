@@ -0,0 +1,81 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/mapped_ladder_graph.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("mapped ladder graph matches the graph it was saved from") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	auto lexicon = std::unordered_set<std::string>();
+	for (auto const& word : english_lexicon) {
+		if (word.size() <= 4) {
+			lexicon.insert(word);
+		}
+	}
+	auto const owner = word_ladder::ladder_graph(lexicon);
+	auto const path = std::string("mapped_ladder_graph_test.graph");
+	word_ladder::save_ladder_graph(owner, path);
+
+	auto mapped = word_ladder::mapped_ladder_graph(path);
+	auto const graph = mapped.view();
+	auto const original = owner.view();
+	REQUIRE(graph.size() == original.size());
+	CHECK(graph.edge_count() == original.edge_count());
+	CHECK(graph.max_length() == original.max_length());
+	for (auto id = word_ladder::ladder_graph_view::id_type{0}; id < graph.size(); ++id) {
+		REQUIRE(graph.word(id) == original.word(id));
+		auto const neighbours = graph.neighbours(id);
+		auto const expected = original.neighbours(id);
+		REQUIRE(std::equal(neighbours.begin(), neighbours.end(), expected.begin(), expected.end()));
+	}
+	CHECK(graph.find("work") == original.find("work"));
+	CHECK(graph.find("notaword") == word_ladder::ladder_graph_view::npos);
+
+	SECTION("ladders over the mapped graph are generate's") {
+		for (auto const& [from, to] : {std::pair{"work", "play"},
+		                               std::pair{"cat", "dog"},
+		                               std::pair{"at", "it"},
+		                               std::pair{"work", "work"},
+		                               std::pair{"work", "cat"},
+		                               std::pair{"ziti", "ably"}}) {
+			CHECK(word_ladder::generate(from, to, graph) == word_ladder::generate(from, to, lexicon));
+		}
+	}
+
+	SECTION("the mapping survives a move and the file being removed") {
+		auto moved = std::move(mapped);
+		std::remove(path.c_str());
+		CHECK(moved.view().word(moved.view().find("play")) == "play");
+	}
+	std::remove(path.c_str());
+}
+
+TEST_CASE("empty graphs round trip") {
+	auto const owner = word_ladder::ladder_graph(std::unordered_set<std::string>{});
+	auto const path = std::string("mapped_ladder_graph_test_empty.graph");
+	word_ladder::save_ladder_graph(owner, path);
+	auto const mapped = word_ladder::mapped_ladder_graph(path);
+	CHECK(mapped.view().size() == 0);
+	CHECK(mapped.view().find("a") == word_ladder::ladder_graph_view::npos);
+	std::remove(path.c_str());
+}
+
+TEST_CASE("files that are not ladder graphs are rejected") {
+	CHECK_THROWS_AS(word_ladder::mapped_ladder_graph("no_such_file.graph"), std::runtime_error);
+	auto const path = std::string("mapped_ladder_graph_test_bad.graph");
+	{
+		auto out = std::ofstream(path);
+		out << "this is a word list, not a graph\n";
+	}
+	CHECK_THROWS_AS(word_ladder::mapped_ladder_graph(path), std::runtime_error);
+	std::remove(path.c_str());
+}
@@ -0,0 +1,37 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("parallel enumeration is identical to generate") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+
+	SECTION("work->play across thread counts") {
+		auto const expected = word_ladder::generate("work", "play", english_lexicon);
+		for (auto threads : {1U, 2U, 3U, 16U}) {
+			CHECK(word_ladder::generate_parallel("work", "play", english_lexicon, threads) == expected);
+		}
+	}
+
+	SECTION("many ladders (atlases->cabaret)") {
+		auto const dag = word_ladder::build_ladder_dag("atlases", "cabaret", english_lexicon);
+		auto const sequential = word_ladder::enumerate_ladders(dag);
+		CHECK(sequential.size() > 100);
+		CHECK(std::is_sorted(sequential.begin(), sequential.end()));
+		CHECK(word_ladder::enumerate_ladders_parallel(dag, 4) == sequential);
+	}
+
+	SECTION("single step and no ladder") {
+		auto const test_lexicon =
+		   word_ladder::read_lexicon("../../test/word_ladder/english_test.txt");
+		CHECK(word_ladder::generate_parallel("aaaaa", "baaae", test_lexicon, 4)
+		      == word_ladder::generate("aaaaa", "baaae", test_lexicon));
+		CHECK(word_ladder::generate_parallel("hansel", "gretel", test_lexicon, 4).empty());
+		auto const dag = word_ladder::build_ladder_dag("aaaa", "aaba", test_lexicon);
+		CHECK(word_ladder::enumerate_ladders_parallel(dag, 8)
+		      == std::vector<std::vector<std::string>>{{"aaaa", "aaba"}});
+	}
+}
@@ -0,0 +1,90 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/position_alphabet.hpp>
+#include <comp6771/probe_lexicon.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("letters are collected per length and position") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "dog", "at", "it", "A1", "b2"};
+	auto const alphabet = word_ladder::position_alphabet(lexicon);
+	CHECK(alphabet.max_length() == 3);
+	CHECK(alphabet.letters(3, 0) == "cd");
+	CHECK(alphabet.letters(3, 1) == "ao");
+	CHECK(alphabet.letters(3, 2) == "gt");
+	CHECK(alphabet.letters(2, 0) == "Aabi");
+	CHECK(alphabet.letters(2, 1) == "12t");
+	CHECK(alphabet.letters(1, 0).empty());
+	CHECK(alphabet.letters(4, 0).empty());
+	CHECK(alphabet.letters(3, 3).empty());
+	CHECK(alphabet.contains(3, 1, 'o'));
+	CHECK(!alphabet.contains(3, 1, 'i'));
+	CHECK(!alphabet.contains(9, 0, 'a'));
+}
+
+TEST_CASE("position alphabets find every substitution in english") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	auto const alphabet = word_ladder::position_alphabet(english_lexicon);
+	for (auto const* word : {"at", "cat", "work", "play", "atlases", "cabaret", "hansel"}) {
+		// every byte at every position, in the order the tables list letters
+		auto expected = std::vector<std::string>();
+		auto candidate = std::string(word);
+		for (auto i = std::size_t{0}; i < candidate.size(); ++i) {
+			for (auto byte = 1; byte < 256; ++byte) {
+				candidate[i] = static_cast<char>(byte);
+				if (candidate != word && english_lexicon.contains(candidate)) {
+					expected.push_back(candidate);
+				}
+			}
+			candidate[i] = word[i];
+		}
+
+		auto queue = std::deque<std::string>();
+		auto map = std::unordered_map<std::string, std::vector<std::string>>();
+		word_ladder::singleLetterDiff(word, english_lexicon, alphabet, queue, map);
+		CHECK(map[word] == expected);
+		CHECK(std::vector<std::string>(queue.begin(), queue.end()) == expected);
+	}
+}
+
+TEST_CASE("lexicons beyond 'a' to 'z' get neighbours") {
+	auto const lexicon = std::unordered_set<std::string>{"R2D2", "R2D3", "C3P0", "C3PO", "R2d2",
+	                                                     "caf\xc3\xa9", "caf\xc3\xa8", "cafe"};
+	auto const alphabet = word_ladder::position_alphabet(lexicon);
+
+	auto queue = std::deque<std::string>();
+	auto map = std::unordered_map<std::string, std::vector<std::string>>();
+	word_ladder::singleLetterDiff("R2D2", lexicon, alphabet, queue, map);
+	CHECK(map["R2D2"] == std::vector<std::string>{"R2d2", "R2D3"});
+	word_ladder::singleLetterDiff("C3P0", lexicon, alphabet, queue, map);
+	CHECK(map["C3P0"] == std::vector<std::string>{"C3PO"});
+
+	// utf-8 letters are substituted byte by byte
+	auto const probes = word_ladder::probe_lexicon(lexicon);
+	CHECK(probes.neighbours("caf\xc3\xa9") == std::vector<std::string>{"caf\xc3\xa8"});
+	CHECK(probes.neighbours("cafe").empty());
+
+	auto const owner = word_ladder::ladder_graph(lexicon);
+	auto const graph = owner.view();
+	auto neighbours = std::vector<std::string_view>();
+	for (auto id : graph.neighbours(graph.find("R2D3"))) {
+		neighbours.push_back(graph.word(id));
+	}
+	std::sort(neighbours.begin(), neighbours.end());
+	CHECK(neighbours == std::vector<std::string_view>{"R2D2"});
+
+	// generate and the lexicon dag search use the same alphabets
+	auto const expected = std::vector<std::vector<std::string>>{{"R2D3", "R2D2", "R2d2"}};
+	CHECK(word_ladder::generate("R2D3", "R2d2", lexicon) == expected);
+	CHECK(word_ladder::enumerate_ladders(word_ladder::build_ladder_dag("R2D3", "R2d2", lexicon))
+	      == expected);
+}
@@ -0,0 +1,61 @@
+#include <comp6771/position_alphabet.hpp>
+#include <comp6771/probe_lexicon.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("probe lexicon (english)") {
+	auto const english_lexicon = word_ladder::read_lexicon("../../test/word_ladder/english.txt");
+	auto const lexicon = word_ladder::probe_lexicon(english_lexicon);
+	CHECK(lexicon.size() == english_lexicon.size());
+
+	SECTION("batched probes agree with single probes") {
+		auto const words = std::vector<std::string>{"work", "play", "", "workk", "zzzzzzz", "atlases",
+		                                            "cabaret", "notaword", "at", "a", "cat", "dog",
+		                                            "hansel", "gretel", "ably", "ziti", "plau", "wor"};
+		auto views = std::vector<std::string_view>(words.begin(), words.end());
+		auto const found = std::make_unique<bool[]>(views.size());
+		lexicon.contains(views, {found.get(), views.size()});
+		for (auto i = std::size_t{0}; i < words.size(); ++i) {
+			CHECK(found[i] == english_lexicon.contains(words[i]));
+			CHECK(lexicon.contains(words[i]) == english_lexicon.contains(words[i]));
+		}
+	}
+
+	SECTION("neighbours match singleLetterDiff") {
+		auto const alphabet = word_ladder::position_alphabet(english_lexicon);
+		for (auto const* word : {"at", "cat", "work", "play", "atlases", "cabaret", "hansel"}) {
+			auto queue = std::deque<std::string>();
+			auto map = std::unordered_map<std::string, std::vector<std::string>>();
+			word_ladder::singleLetterDiff(word, english_lexicon, alphabet, queue, map);
+
+			auto batched_queue = std::deque<std::string>();
+			auto batched_map = std::unordered_map<std::string, std::vector<std::string>>();
+			word_ladder::singleLetterDiff(word, lexicon, batched_queue, batched_map);
+			CHECK(batched_map == map);
+			CHECK(batched_queue == queue);
+		}
+	}
+
+	SECTION("ladders match generate") {
+		CHECK(word_ladder::generate("work", "play", lexicon)
+		      == word_ladder::generate("work", "play", english_lexicon));
+		CHECK(word_ladder::generate("awake", "sleep", lexicon)
+		      == word_ladder::generate("awake", "sleep", english_lexicon));
+	}
+}
+
+TEST_CASE("empty probe lexicon") {
+	auto const lexicon = word_ladder::probe_lexicon(std::unordered_set<std::string>{});
+	CHECK(lexicon.size() == 0);
+	CHECK(!lexicon.contains("a"));
+	CHECK(lexicon.neighbours("cat").empty());
+}
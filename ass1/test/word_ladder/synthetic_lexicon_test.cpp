@@ -0,0 +1,74 @@
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/synthetic_lexicon.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("synthetic lexicons follow their options") {
+	auto options = word_ladder::synthetic_lexicon_options();
+	options.words = 5000;
+	options.min_length = 3;
+	options.max_length = 6;
+	options.length_weights = {1, 0, 3};
+	options.alphabet = "abcdefgh";
+	auto const words = word_ladder::generate_synthetic_lexicon(options);
+
+	CHECK(words.size() == options.words);
+	CHECK(std::is_sorted(words.begin(), words.end()));
+	CHECK(std::adjacent_find(words.begin(), words.end()) == words.end());
+	CHECK(std::all_of(words.begin(), words.end(), [](auto const& word) {
+		return (word.size() == 3 || word.size() == 5)
+		       && word.find_first_not_of("abcdefgh") == std::string::npos;
+	}));
+	// 3 letter words run out at 8^3, the rest go to the other length with a weight
+	CHECK(std::count_if(words.begin(), words.end(), [](auto const& word) { return word.size() == 3; })
+	      <= 512);
+
+	SECTION("the same seed gives the same lexicon") {
+		CHECK(word_ladder::generate_synthetic_lexicon(options) == words);
+		options.seed = 2;
+		CHECK(word_ladder::generate_synthetic_lexicon(options) != words);
+	}
+
+	SECTION("round trips through read_lexicon") {
+		auto const path = std::string("synthetic_lexicon_test.txt");
+		word_ladder::write_lexicon(words, path);
+		auto const expected = std::unordered_set<std::string>(words.begin(), words.end());
+		CHECK(word_ladder::read_lexicon(path) == expected);
+		std::remove(path.c_str());
+	}
+}
+
+TEST_CASE("density controls how many neighbours words have") {
+	auto options = word_ladder::synthetic_lexicon_options();
+	options.words = 3000;
+	options.min_length = 6;
+	options.max_length = 6;
+	auto const edges = [&](double density) {
+		options.density = density;
+		auto const words = word_ladder::generate_synthetic_lexicon(options);
+		return word_ladder::ladder_graph({words.begin(), words.end()}).view().edge_count();
+	};
+	auto const sparse = edges(0.0);
+	auto const dense = edges(0.9);
+	CHECK(sparse < dense);
+	CHECK(dense > 3000);
+}
+
+TEST_CASE("impossible synthetic lexicons are rejected") {
+	auto options = word_ladder::synthetic_lexicon_options();
+	options.words = 100;
+	options.min_length = 2;
+	options.max_length = 2;
+	options.alphabet = "ab";
+	CHECK_THROWS_AS(word_ladder::generate_synthetic_lexicon(options), std::invalid_argument);
+	options.alphabet = "";
+	CHECK_THROWS_AS(word_ladder::generate_synthetic_lexicon(options), std::invalid_argument);
+}
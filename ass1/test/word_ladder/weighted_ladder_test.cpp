@@ -0,0 +1,191 @@
+#include <comp6771/ladder_dag.hpp>
+#include <comp6771/ladder_graph.hpp>
+#include <comp6771/radix_heap.hpp>
+#include <comp6771/weighted_ladder.hpp>
+#include <comp6771/word_ladder.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "english_words.hpp"
+
+namespace {
+	auto neighbours_of(std::string const& word, std::unordered_set<std::string> const& lexicon)
+	   -> std::vector<std::string> {
+		auto result = std::vector<std::string>();
+		auto candidate = word;
+		for (auto i = std::size_t{0}; i < word.size(); ++i) {
+			for (auto letter = 'a'; letter <= 'z'; ++letter) {
+				candidate[i] = letter;
+				if (candidate != word && lexicon.contains(candidate)) {
+					result.push_back(candidate);
+				}
+			}
+			candidate[i] = word[i];
+		}
+		return result;
+	}
+
+	// textbook dijkstra over every word, then every ladder found by walking tight edges back
+	// from "to"
+	auto reference_weighted(std::string const& from,
+	                        std::string const& to,
+	                        std::unordered_set<std::string> const& lexicon,
+	                        std::unordered_map<std::string, std::uint32_t> const& costs)
+	   -> std::vector<std::vector<std::string>> {
+		auto const cost_of = [&](std::string const& word) {
+			auto const found = costs.find(word);
+			return found == costs.end() ? std::uint64_t{1} : std::uint64_t{found->second};
+		};
+		auto distance = std::unordered_map<std::string, std::uint64_t>{{from, 0}};
+		using entry = std::pair<std::uint64_t, std::string>;
+		auto queue = std::priority_queue<entry, std::vector<entry>, std::greater<>>();
+		queue.emplace(0, from);
+		while (!queue.empty()) {
+			auto const [cost, word] = queue.top();
+			queue.pop();
+			if (cost != distance[word]) {
+				continue;
+			}
+			for (auto const& neighbour : neighbours_of(word, lexicon)) {
+				auto const through = cost + cost_of(neighbour);
+				auto const known = distance.find(neighbour);
+				if (known == distance.end() || through < known->second) {
+					distance[neighbour] = through;
+					queue.emplace(through, neighbour);
+				}
+			}
+		}
+		if (!distance.contains(to)) {
+			return {};
+		}
+
+		auto ladders = std::vector<std::vector<std::string>>();
+		auto path = std::vector<std::string>();
+		auto const walk = [&](auto const& self, std::string const& word) -> void {
+			path.push_back(word);
+			if (word == from) {
+				ladders.emplace_back(path.rbegin(), path.rend());
+			}
+			for (auto const& neighbour : neighbours_of(word, lexicon)) {
+				auto const known = distance.find(neighbour);
+				if (known != distance.end() && known->second + cost_of(word) == distance[word]) {
+					self(self, neighbour);
+				}
+			}
+			path.pop_back();
+		};
+		walk(walk, to);
+		std::sort(ladders.begin(), ladders.end());
+		return ladders;
+	}
+
+	auto small_lexicon() -> std::unordered_set<std::string> const& {
+		return english_words<3, 3>().lexicon;
+	}
+} // namespace
+
+TEST_CASE("radix heap pops in key order") {
+	auto rng = std::mt19937_64(7);
+	auto heap = word_ladder::radix_heap();
+	using min_queue = std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>>;
+	auto reference = min_queue();
+	auto last = std::uint64_t{0};
+	for (auto round = 0; round < 2000; ++round) {
+		for (auto i = rng() % 4; i > 0; --i) {
+			auto const key = last + rng() % 1000;
+			heap.push(key, static_cast<std::uint32_t>(key & 0xFFFFU));
+			reference.push(key);
+		}
+		if (!reference.empty()) {
+			auto const [key, value] = heap.pop();
+			CHECK(key == reference.top());
+			CHECK(value == (key & 0xFFFFU));
+			last = key;
+			reference.pop();
+		}
+		REQUIRE(heap.size() == reference.size());
+	}
+	CHECK_THROWS_AS(heap.push(last - 1, 0), std::logic_error);
+}
+
+TEST_CASE("unit costs give generate's ladders") {
+	auto const& lexicon = small_lexicon();
+	auto const no_costs = std::unordered_map<std::string, std::uint32_t>();
+	for (auto const& [from, to] : {std::pair{"cat", "dog"}, std::pair{"ape", "man"}}) {
+		CHECK(word_ladder::generate_weighted(from, to, lexicon, no_costs)
+		      == word_ladder::generate(from, to, lexicon));
+	}
+	CHECK(word_ladder::generate_weighted("cat", "cat", lexicon, no_costs)
+	      == std::vector<std::vector<std::string>>{{"cat"}});
+	CHECK(word_ladder::generate_weighted("cat", "work", lexicon, no_costs).empty());
+}
+
+TEST_CASE("weighted ladders match a reference dijkstra") {
+	auto const& lexicon = small_lexicon();
+	auto const owner = word_ladder::ladder_graph(lexicon);
+	auto const graph = owner.view();
+
+	auto rng = std::mt19937_64(11);
+	for (auto const max_cost : {std::uint32_t{2}, std::uint32_t{5}, std::uint32_t{1000}}) {
+		auto costs = std::unordered_map<std::string, std::uint32_t>();
+		auto costs_by_id = std::vector<std::uint32_t>(graph.size());
+		for (auto id = word_ladder::ladder_graph_view::id_type{0}; id < graph.size(); ++id) {
+			auto const cost = static_cast<std::uint32_t>(1 + rng() % max_cost);
+			costs.emplace(graph.word(id), cost);
+			costs_by_id[id] = cost;
+		}
+		for (auto const& [from, to] :
+		     {std::pair{"cat", "dog"}, std::pair{"ape", "man"}, std::pair{"ink", "owl"}}) {
+			auto const expected = reference_weighted(from, to, lexicon, costs);
+			CHECK(!expected.empty());
+			CHECK(word_ladder::generate_weighted(from, to, lexicon, costs) == expected);
+			CHECK(word_ladder::generate_weighted(from, to, graph, costs_by_id) == expected);
+		}
+	}
+}
+
+TEST_CASE("weighted ladders prefer cheap words") {
+	auto const lexicon = std::unordered_set<std::string>{"aaa", "baa", "bba", "bbb", "aba", "abb"};
+	auto costs = std::unordered_map<std::string, std::uint32_t>{{"baa", 10}};
+	CHECK(word_ladder::generate_weighted("aaa", "bbb", lexicon, costs)
+	      == std::vector<std::vector<std::string>>{{"aaa", "aba", "abb", "bbb"},
+	                                               {"aaa", "aba", "bba", "bbb"}});
+	costs["aba"] = 0;
+	CHECK_THROWS_AS(word_ladder::generate_weighted("aaa", "bbb", lexicon, costs),
+	                std::invalid_argument);
+	auto const owner = word_ladder::ladder_graph(lexicon);
+	auto const too_few = std::vector<std::uint32_t>{1};
+	CHECK_THROWS_AS(word_ladder::generate_weighted("aaa", "bbb", owner, too_few),
+	                std::invalid_argument);
+}
+
+TEST_CASE("weighted ladders substitute letters beyond 'a' to 'z'") {
+	auto const lexicon =
+	   std::unordered_set<std::string>{"R2D2", "R2D3", "R2d2", "R2d3", "C3P0", "C3PO"};
+	auto const alphabet = word_ladder::position_alphabet(lexicon);
+	auto costs = std::unordered_map<std::string, std::uint32_t>();
+	CHECK(word_ladder::generate_weighted("R2D3", "R2d2", lexicon, costs)
+	      == std::vector<std::vector<std::string>>{{"R2D3", "R2D2", "R2d2"},
+	                                               {"R2D3", "R2d3", "R2d2"}});
+	CHECK(word_ladder::generate_weighted("R2D3", "R2d2", lexicon, costs)
+	      == word_ladder::generate("R2D3", "R2d2", lexicon));
+	CHECK(word_ladder::generate_weighted("C3P0", "C3PO", lexicon, alphabet, costs)
+	      == std::vector<std::vector<std::string>>{{"C3P0", "C3PO"}});
+
+	costs["R2D2"] = 5;
+	CHECK(word_ladder::generate_weighted("R2D3", "R2d2", lexicon, alphabet, costs)
+	      == std::vector<std::vector<std::string>>{{"R2D3", "R2d3", "R2d2"}});
+}
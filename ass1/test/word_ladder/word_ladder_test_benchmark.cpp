@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <comp6771/ladder_dag.hpp>
 #include <comp6771/word_ladder.hpp>
 
 #include <string>
@@ -25,4 +26,5 @@ TEST_CASE("atlases -> cabaret") {
 	auto const ladders = ::word_ladder::generate("atlases", "cabaret", english_lexicon);
 
 	CHECK(std::size(ladders) != 0);
+	CHECK(::word_ladder::generate_parallel("atlases", "cabaret", english_lexicon) == ladders);
 }
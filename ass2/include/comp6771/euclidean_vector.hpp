@@ -2,115 +2,816 @@
 #define COMP6771_EUCLIDEAN_VECTOR_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
 #include <functional>
+#include <initializer_list>
 #include <list>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+// vectors with up to this many dimensions keep their magnitudes inside the object, and only larger
+// ones allocate. the library and everything using it must agree on the value, so it is set project
+// wide (the EUCLIDEAN_VECTOR_INLINE_CAPACITY cmake cache variable) rather than per file.
+#ifndef COMP6771_EUCLIDEAN_VECTOR_INLINE_CAPACITY
+#define COMP6771_EUCLIDEAN_VECTOR_INLINE_CAPACITY 16
+#endif
+
 namespace comp6771 {
+	template<typename Scalar>
+	class basic_euclidean_vector;
+	template<typename Magnitude>
+	class euclidean_vector_view;
+
+	// magnitudes are doubles unless chosen otherwise. basic_euclidean_vector<float> halves the
+	// memory (and the memory traffic of every kernel) for data that does not need doubles, such as
+	// embeddings.
+	using euclidean_vector = basic_euclidean_vector<double>;
+
+	// the magnitude types a euclidean_vector can hold
+	template<typename T>
+	concept vector_scalar = std::same_as<T, float> || std::same_as<T, double>;
+
+	namespace detail {
+		struct vector_access;
+	} // namespace detail
+
+	/////// ARITHMETIC AND EXPRESSION TEMPLATES ///////
+	// a + b, a - b, a * k, k * a and a / k give a euclidean_vector, computed straight away in one
+	// loop into the result's storage (one allocation, or none when it fits inline).
+	//
+	// a temporary euclidean_vector operand (std::move(a), or the result of another operator) is
+	// about to go away anyway, so the operator works in its storage and returns it. so a chain
+	// only allocates for its first result: a + b * 2 - c allocates for b * 2 and reuses that
+	// storage after it, and std::move(a) + b + c allocates nothing at all.
+	//
+	// fused evaluation is opt in. lazy(a) is an expression for a, and an operator with an
+	// expression operand computes nothing: it returns a small expression object that remembers its
+	// operands, and the work happens when the expression is turned into a euclidean_vector (by
+	// constructing, assigning or passing it to something taking one), in one loop straight into
+	// the destination. so euclidean_vector(lazy(a) + lazy(b) * 2 - c) allocates once, and assigning
+	// it to a vector of the same dimensions allocates nothing. lvalue operands are held by
+	// reference and temporaries are moved in, so an expression is only valid while its named
+	// operands are alive and unchanged (like a view): do not return one from a function or keep it
+	// in an auto variable past a change to its operands. dimension mismatches and division by 0
+	// still throw where the operator is written, lazy or not.
+	//
+	// an expression reads like a const euclidean_vector: it has dimensions(), [], at() and the
+	// explicit std::vector and std::list conversions, and converts to a euclidean_vector for
+	// everything else.
+	//
+	// vectors, views and expressions all have a value_type (the type of their magnitudes), and the
+	// operands of one expression must have the same one: a float vector plus a double one does not
+	// compile, so convert one of them first. scalars are converted to the value_type.
+	template<typename T>
+	inline constexpr bool is_vector_expression = false;
+
+	// a lazy expression (not a euclidean_vector itself)
+	template<typename T>
+	concept vector_expression = is_vector_expression<std::remove_cvref_t<T>>;
+
+	// a lazy expression whose elements are Scalars
+	template<typename T, typename Scalar>
+	concept vector_expression_of =
+	   vector_expression<T> && std::same_as<typename std::remove_cvref_t<T>::value_type, Scalar>;
+
+	template<typename T>
+	inline constexpr bool is_euclidean_vector = false;
+	template<typename Scalar>
+	inline constexpr bool is_euclidean_vector<basic_euclidean_vector<Scalar>> = true;
+
+	template<typename T>
+	inline constexpr bool is_vector_view = false;
+	template<typename Magnitude>
+	inline constexpr bool is_vector_view<euclidean_vector_view<Magnitude>> = true;
+
+	// a euclidean_vector_view, const or mutable
+	template<typename T>
+	concept vector_view = is_vector_view<std::remove_cvref_t<T>>;
+
+	// anything the arithmetic operators accept
+	template<typename T>
+	concept vector_operand =
+	   vector_expression<T> || vector_view<T> || is_euclidean_vector<std::remove_cvref_t<T>>;
+
 	class euclidean_vector_error : public std::runtime_error {
 	public:
 		explicit euclidean_vector_error(std::string const& what)
 		: std::runtime_error(what) {}
 	};
 
-	class euclidean_vector {
+	// a euclidean_vector of Scalar (float or double) magnitudes. everything below is built once
+	// for each, in the library.
+	template<typename Scalar>
+	class basic_euclidean_vector {
 	public:
-		// variables (for caching euclidean norm utility function)
-		// if find_normal is true, this means that euclidean normal has not been calculated for
-		// current euclidean vector
-		// (this could be due to euclidean_norm function never being called, or euclidean vector's
-		// values changed after euclidean_norm has been called, which requires us to find the
-		// euclidean normal again)
-		bool mutable find_normal;
-		// normal variable to cache and store euclidean normal of current euclidean vector
-		double mutable normal;
+		static_assert(vector_scalar<Scalar>);
+		using value_type = Scalar;
 
 		////// HELPER FUNCTIONS ///////
 		// returns magnitudes of given function (for const and non-const)
-		auto magnitudes() -> std::vector<double>;
-		auto magnitudes() const -> std::vector<double>;
+		auto magnitudes() -> std::vector<Scalar>;
+		auto magnitudes() const -> std::vector<Scalar>;
 
 		/////// CONSTRUCTORS ////////
 		// default constructor
-		euclidean_vector();
+		basic_euclidean_vector();
 		// single-argument constructor
-		explicit euclidean_vector(int num_dimensions);
+		explicit basic_euclidean_vector(int num_dimensions);
 		// other constructors
-		euclidean_vector(int num_dimensions, double magnitude);
-		euclidean_vector(std::vector<double>::const_iterator begin_iterator,
-		                 std::vector<double>::const_iterator end_iterator);
-		euclidean_vector(std::initializer_list<double> init_list);
+		basic_euclidean_vector(int num_dimensions, Scalar magnitude);
+		basic_euclidean_vector(typename std::vector<Scalar>::const_iterator begin_iterator,
+		                       typename std::vector<Scalar>::const_iterator end_iterator);
+		basic_euclidean_vector(std::initializer_list<Scalar> init_list);
 		// copy constructor
-		euclidean_vector(euclidean_vector const& src_vector) noexcept;
+		basic_euclidean_vector(basic_euclidean_vector const& src_vector) noexcept;
 		// move constructor
-		euclidean_vector(euclidean_vector&& src_vector) noexcept;
+		basic_euclidean_vector(basic_euclidean_vector&& src_vector) noexcept;
+		// copies the magnitudes a view looks at
+		explicit basic_euclidean_vector(euclidean_vector_view<Scalar const> view);
+		// converts every magnitude of a vector of the other scalar type (doubles to floats rounds)
+		template<vector_scalar Other>
+		requires(not std::same_as<Other, Scalar>)
+		explicit basic_euclidean_vector(basic_euclidean_vector<Other> const& vector);
+		// evaluates an expression (a + b * 2 - c etc) in one pass into a new allocation
+		template<vector_expression_of<Scalar> E>
+		// NOLINTNEXTLINE(google-explicit-constructor)
+		basic_euclidean_vector(E const& expression);
 
 		/////// DESTRUCTOR /////////
-		~euclidean_vector();
+		~basic_euclidean_vector();
 
 		//////// OPERATIONS ///////
 		// copy assignment
-		auto operator=(euclidean_vector const& orig) -> euclidean_vector&;
+		auto operator=(basic_euclidean_vector const& orig) -> basic_euclidean_vector&;
 		// move assignment
-		auto operator=(euclidean_vector&& orig) noexcept -> euclidean_vector&;
+		auto operator=(basic_euclidean_vector&& orig) noexcept -> basic_euclidean_vector&;
+		// expression assignment (evaluated in place when the dimensions already match)
+		template<vector_expression_of<Scalar> E>
+		auto operator=(E const& expression) -> basic_euclidean_vector&;
 		// subscript (const and non const)
-		auto operator[](int index) const -> double;
-		auto operator[](int index) -> double&;
+		auto operator[](int index) const -> Scalar;
+		auto operator[](int index) -> Scalar&;
 		// unary plus
-		auto operator+() -> euclidean_vector;
-		// negation
-		auto operator-() -> euclidean_vector;
+		auto operator+() -> basic_euclidean_vector;
+		// negation (a temporary is negated in place)
+		auto operator-() const& -> basic_euclidean_vector;
+		auto operator-() && -> basic_euclidean_vector;
 		// compound addition
-		auto operator+=(euclidean_vector const& vector) -> euclidean_vector&;
+		auto operator+=(basic_euclidean_vector const& vector) -> basic_euclidean_vector&;
 		/// compound subtraction
-		auto operator-=(euclidean_vector const& vector) -> euclidean_vector&;
+		auto operator-=(basic_euclidean_vector const& vector) -> basic_euclidean_vector&;
+		// compound addition and subtraction of the magnitudes a view looks at
+		auto operator+=(euclidean_vector_view<Scalar const> view) -> basic_euclidean_vector&;
+		auto operator-=(euclidean_vector_view<Scalar const> view) -> basic_euclidean_vector&;
+		// compound addition and subtraction of an expression, without evaluating it first
+		template<vector_expression_of<Scalar> E>
+		auto operator+=(E const& expression) -> basic_euclidean_vector&;
+		template<vector_expression_of<Scalar> E>
+		auto operator-=(E const& expression) -> basic_euclidean_vector&;
 		// compound multiplication
-		auto operator*=(double multiplier) -> euclidean_vector&;
+		auto operator*=(Scalar multiplier) -> basic_euclidean_vector&;
 		// compound division
-		auto operator/=(double divisor) -> euclidean_vector&;
+		auto operator/=(Scalar divisor) -> basic_euclidean_vector&;
 		// vector type conversion
-		explicit operator std::vector<double>() const;
-		explicit operator std::vector<double>();
+		explicit operator std::vector<Scalar>() const;
+		explicit operator std::vector<Scalar>();
 		// list type conversion
-		explicit operator std::list<double>() const;
-		explicit operator std::list<double>();
+		explicit operator std::list<Scalar>() const;
+		explicit operator std::list<Scalar>();
 
 		///// MEMBER FUNCTIONS ///////
-		auto at(int dimension) const -> double;
-		auto at(int dimension) -> double&;
+		auto at(int dimension) const -> Scalar;
+		auto at(int dimension) -> Scalar&;
 		auto dimensions() const -> int;
 
-		/////// FRIENDS /////////
-		// equal
-		friend auto operator==(euclidean_vector const& first, euclidean_vector const& second) -> bool;
-		// not equal
-		friend auto operator!=(euclidean_vector const& first, euclidean_vector const& second) -> bool;
-		// addition
-		friend auto operator+(euclidean_vector const& first, euclidean_vector const& second)
-		   -> euclidean_vector;
-		// subtraction
-		friend auto operator-(euclidean_vector const& first, euclidean_vector const& second)
-		   -> euclidean_vector;
-		// multiply
-		friend auto operator*(euclidean_vector const& vector, double multiplier) -> euclidean_vector;
-		friend auto operator*(double multiplier, euclidean_vector const& vector) -> euclidean_vector;
-		// divide
-		friend auto operator/(euclidean_vector const& vector, double divisor) -> euclidean_vector;
-		// output stream
-		friend auto operator<<(std::ostream& output, euclidean_vector const& vector) -> std::ostream&;
+		// (==, != and << are declared after the class, once for each scalar type, and addition,
+		// subtraction, multiply and divide are the operators below)
+
+		// number of dimensions stored without a heap allocation
+		static constexpr int inline_capacity = COMP6771_EUCLIDEAN_VECTOR_INLINE_CAPACITY;
+		static_assert(inline_capacity >= 0);
 
 	private:
-		// ass2 spec requires we use std::unique_ptr<double[]>
-		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
-		std::unique_ptr<double[]> magnitudes_;
+		friend struct detail::vector_access;
+
+		// points magnitudes_ at storage for num_dimensions magnitudes (left unset): the inline
+		// array when they fit, a new heap block otherwise
+		auto allocate(int num_dimensions) -> void;
+		// takes over other's magnitudes (its heap block, or a copy of its inline ones) and leaves
+		// other with no dimensions
+		auto take(basic_euclidean_vector& other) noexcept -> void;
+		// forgets the cached norm, for anything that changes (or might change) the magnitudes
+		auto invalidate_norm() noexcept -> void {
+			norm_.store(norm_not_cached, std::memory_order_relaxed);
+		}
+
+		// a norm is never negative, so this marks one that has not been worked out (yet, or since
+		// the magnitudes last changed)
+		static constexpr Scalar norm_not_cached = -1;
+
+		// the magnitudes, in either inline_magnitudes_ or heap_magnitudes_
+		Scalar* magnitudes_;
 		int num_dimensions_;
+		// ass2 spec requires we use std::unique_ptr<double[]> (for vectors too big to be inline;
+		// Scalar[] now that floats are allowed too)
+		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
+		std::unique_ptr<Scalar[]> heap_magnitudes_;
+		std::array<Scalar, inline_capacity> inline_magnitudes_;
+		// the euclidean norm, cached by euclidean_norm. it is atomic so that threads sharing a const
+		// vector can all call euclidean_norm: a few of them may work the norm out at once, but they
+		// all store the same value. relaxed is enough, since the value is all that is passed on,
+		// and changing the magnitudes needs a non const vector (which no other thread may be
+		// using).
+		mutable std::atomic<Scalar> norm_ = norm_not_cached;
 	};
 
+	// the members are built once, in the library
+	extern template class basic_euclidean_vector<double>;
+	extern template class basic_euclidean_vector<float>;
+
 	/////// UTILITY FUNCTIONS ///////
 	// (put outside of public since it is not supposed to be part of euclidean_vector interface)
 	auto euclidean_norm(euclidean_vector const& vector) -> double;
 	auto unit(euclidean_vector const& vector) -> euclidean_vector;
+	// divides a temporary in place
+	auto unit(euclidean_vector&& vector) -> euclidean_vector;
 	auto dot(euclidean_vector const& first, euclidean_vector const& second) -> double;
+	// dot and euclidean_norm added up in double whatever the magnitudes are (for doubles, the
+	// same as dot and euclidean_norm)
+	auto extended_dot(euclidean_vector const& first, euclidean_vector const& second) -> double;
+	auto extended_euclidean_norm(euclidean_vector const& vector) -> double;
+
+	// also declared out here so that expressions, which convert to euclidean_vector, can be
+	// compared and printed
+	auto operator==(euclidean_vector const& first, euclidean_vector const& second) -> bool;
+	auto operator!=(euclidean_vector const& first, euclidean_vector const& second) -> bool;
+	auto operator<<(std::ostream& output, euclidean_vector const& vector) -> std::ostream&;
+
+	// the same for views (and a view with a euclidean_vector). views never cache the norm.
+	auto euclidean_norm(euclidean_vector_view<double const> vector) -> double;
+	auto unit(euclidean_vector_view<double const> vector) -> euclidean_vector;
+	auto dot(euclidean_vector_view<double const> first, euclidean_vector_view<double const> second)
+	   -> double;
+	auto extended_dot(euclidean_vector_view<double const> first,
+	                  euclidean_vector_view<double const> second) -> double;
+	auto extended_euclidean_norm(euclidean_vector_view<double const> vector) -> double;
+	auto operator==(euclidean_vector_view<double const> first,
+	                euclidean_vector_view<double const> second) -> bool;
+	auto operator!=(euclidean_vector_view<double const> first,
+	                euclidean_vector_view<double const> second) -> bool;
+	auto operator<<(std::ostream& output, euclidean_vector_view<double const> vector)
+	   -> std::ostream&;
+
+	// and all of it again for floats. these are overloads rather than templates so that
+	// expressions and vectors still convert to the parameters. dot and euclidean_norm of floats
+	// add up in float; extended_dot and extended_euclidean_norm add up in double, which costs
+	// little (the floats are still what is read from memory) and loses far less to rounding over
+	// many dimensions.
+	auto euclidean_norm(basic_euclidean_vector<float> const& vector) -> float;
+	auto unit(basic_euclidean_vector<float> const& vector) -> basic_euclidean_vector<float>;
+	auto unit(basic_euclidean_vector<float>&& vector) -> basic_euclidean_vector<float>;
+	auto dot(basic_euclidean_vector<float> const& first, basic_euclidean_vector<float> const& second)
+	   -> float;
+	auto extended_dot(basic_euclidean_vector<float> const& first,
+	                  basic_euclidean_vector<float> const& second) -> double;
+	auto extended_euclidean_norm(basic_euclidean_vector<float> const& vector) -> double;
+	auto operator==(basic_euclidean_vector<float> const& first,
+	                basic_euclidean_vector<float> const& second) -> bool;
+	auto operator!=(basic_euclidean_vector<float> const& first,
+	                basic_euclidean_vector<float> const& second) -> bool;
+	auto operator<<(std::ostream& output, basic_euclidean_vector<float> const& vector)
+	   -> std::ostream&;
+
+	auto euclidean_norm(euclidean_vector_view<float const> vector) -> float;
+	auto unit(euclidean_vector_view<float const> vector) -> basic_euclidean_vector<float>;
+	auto dot(euclidean_vector_view<float const> first, euclidean_vector_view<float const> second)
+	   -> float;
+	auto extended_dot(euclidean_vector_view<float const> first,
+	                  euclidean_vector_view<float const> second) -> double;
+	auto extended_euclidean_norm(euclidean_vector_view<float const> vector) -> double;
+	auto operator==(euclidean_vector_view<float const> first,
+	                euclidean_vector_view<float const> second) -> bool;
+	auto operator!=(euclidean_vector_view<float const> first,
+	                euclidean_vector_view<float const> second) -> bool;
+	auto operator<<(std::ostream& output, euclidean_vector_view<float const> vector)
+	   -> std::ostream&;
+
+	// dot and euclidean_norm split across threads threads (0 means
+	// std::thread::hardware_concurrency()), with the reductions in parallel_reduction.hpp, so the
+	// result is the same whatever the number of threads. dot, euclidean_norm, extended_dot and
+	// extended_euclidean_norm already do this from parallel_reduction_threshold dimensions on;
+	// these do it at any size, with the number of threads chosen. vectors convert to the views,
+	// and their norm is not cached.
+	auto parallel_dot(euclidean_vector_view<double const> first,
+	                  euclidean_vector_view<double const> second,
+	                  unsigned threads = 0) -> double;
+	auto parallel_dot(euclidean_vector_view<float const> first,
+	                  euclidean_vector_view<float const> second,
+	                  unsigned threads = 0) -> float;
+	auto parallel_euclidean_norm(euclidean_vector_view<double const> vector, unsigned threads = 0)
+	   -> double;
+	auto parallel_euclidean_norm(euclidean_vector_view<float const> vector, unsigned threads = 0)
+	   -> float;
+
+	namespace detail {
+		// reads magnitudes inline, since operator[] is out of line and would stop the evaluation
+		// loops from being optimised. data gives the utility functions the whole array, and norm
+		// gives euclidean_norm the cache.
+		struct vector_access {
+			template<typename Scalar>
+			static auto element(basic_euclidean_vector<Scalar> const& vector, int index) -> Scalar {
+				return vector.magnitudes_[static_cast<std::size_t>(index)];
+			}
+			template<typename Scalar>
+			static auto data(basic_euclidean_vector<Scalar> const& vector) -> Scalar const* {
+				return vector.magnitudes_;
+			}
+			template<typename Scalar>
+			static auto norm(basic_euclidean_vector<Scalar> const& vector) -> std::atomic<Scalar>& {
+				return vector.norm_;
+			}
+			template<typename Scalar>
+			static constexpr auto norm_not_cached = basic_euclidean_vector<Scalar>::norm_not_cached;
+		};
+
+		[[noreturn]] auto throw_dimension_mismatch(int lhs, int rhs) -> void;
+
+		template<typename Scalar>
+		auto element(basic_euclidean_vector<Scalar> const& vector, int index) -> Scalar {
+			return vector_access::element(vector, index);
+		}
+
+		template<vector_expression E>
+		auto element(E const& expression, int index) -> typename E::value_type {
+			return expression[index];
+		}
+
+		template<vector_view V>
+		auto element(V const& view, int index) -> typename V::value_type {
+			return view[index];
+		}
+
+		// the operands of one expression must have the same value_type
+		template<typename Lhs, typename Rhs>
+		concept same_scalar = std::same_as<typename std::remove_cvref_t<Lhs>::value_type,
+		                                   typename std::remove_cvref_t<Rhs>::value_type>;
+
+		// how an expression holds an operand: lvalues by const reference, temporaries by value
+		template<typename T>
+		using operand_storage = std::conditional_t<std::is_lvalue_reference_v<T>,
+		                                           std::remove_reference_t<T> const&,
+		                                           std::remove_cvref_t<T>>;
+
+		// at and the std::vector and std::list conversions of an expression, with the same checks
+		// and results as a euclidean_vector holding it
+		template<typename Expression>
+		auto checked_element(Expression const& expression, int dimension) ->
+		   typename Expression::value_type {
+			if (dimension < 0 || dimension >= expression.dimensions()) {
+				throw euclidean_vector_error("Index " + std::to_string(dimension)
+				                             + " is not valid for this euclidean_vector object");
+			}
+			return expression[dimension];
+		}
+
+		template<typename Container, typename Expression>
+		auto evaluate_into(Expression const& expression) -> Container {
+			auto magnitudes = Container();
+			for (auto i = 0; i < expression.dimensions(); i++) {
+				magnitudes.push_back(expression[i]);
+			}
+			return magnitudes;
+		}
+	} // namespace detail
+
+	/////// VIEWS ///////
+	// a euclidean_vector that does not own its magnitudes, like std::span: a pointer to
+	// dimensions() doubles (or floats) kept somewhere else (one row of a big buffer of embeddings,
+	// a mapped file, a pool). euclidean_vector_view<double> can change the magnitudes and
+	// euclidean_vector_view<double const> can only read them. nothing is copied, so the memory has
+	// to outlive the view, and copying a view copies the pointer.
+	//
+	// the utility functions, comparisons and output take const views, and views are operands of
+	// the arithmetic operators like euclidean_vectors are. a euclidean_vector converts to a const
+	// view but not to a mutable one, since writing through that would go behind its cached norm.
+	template<typename Magnitude>
+	class euclidean_vector_view {
+	public:
+		static_assert(vector_scalar<std::remove_const_t<Magnitude>>);
+		using value_type = std::remove_const_t<Magnitude>;
+
+		// no dimensions
+		constexpr euclidean_vector_view() noexcept = default;
+		constexpr euclidean_vector_view(Magnitude* magnitudes, int num_dimensions) noexcept
+		: magnitudes_(magnitudes)
+		, num_dimensions_(num_dimensions) {}
+		// NOLINTNEXTLINE(google-explicit-constructor)
+		constexpr euclidean_vector_view(std::span<Magnitude> magnitudes) noexcept
+		: magnitudes_(magnitudes.data())
+		, num_dimensions_(static_cast<int>(magnitudes.size())) {}
+		// a mutable view is also a const one
+		template<typename Other>
+		requires(std::is_const_v<Magnitude> && std::same_as<Other, value_type>)
+		// NOLINTNEXTLINE(google-explicit-constructor)
+		constexpr euclidean_vector_view(euclidean_vector_view<Other> view) noexcept
+		: magnitudes_(view.data())
+		, num_dimensions_(view.dimensions()) {}
+		// NOLINTNEXTLINE(google-explicit-constructor)
+		euclidean_vector_view(basic_euclidean_vector<value_type> const& vector) noexcept
+		requires std::is_const_v<Magnitude>
+		: magnitudes_(detail::vector_access::data(vector))
+		, num_dimensions_(vector.dimensions()) {}
+
+		// subscript, unchecked like euclidean_vector's
+		constexpr auto operator[](int index) const -> Magnitude& {
+			return magnitudes_[static_cast<std::size_t>(index)];
+		}
+		auto at(int dimension) const -> Magnitude&;
+		constexpr auto dimensions() const noexcept -> int {
+			return num_dimensions_;
+		}
+		constexpr auto data() const noexcept -> Magnitude* {
+			return magnitudes_;
+		}
+		constexpr auto begin() const noexcept -> Magnitude* {
+			return magnitudes_;
+		}
+		constexpr auto end() const noexcept -> Magnitude* {
+			return magnitudes_ + num_dimensions_;
+		}
+
+		// compound operations on the viewed magnitudes (mutable views only), with the same simd
+		// kernels and exceptions as euclidean_vector's
+		auto operator+=(euclidean_vector_view<value_type const> view) -> euclidean_vector_view&
+		requires(not std::is_const_v<Magnitude>);
+		auto operator-=(euclidean_vector_view<value_type const> view) -> euclidean_vector_view&
+		requires(not std::is_const_v<Magnitude>);
+		auto operator*=(value_type multiplier) -> euclidean_vector_view&
+		requires(not std::is_const_v<Magnitude>);
+		auto operator/=(value_type divisor) -> euclidean_vector_view&
+		requires(not std::is_const_v<Magnitude>);
+		template<vector_expression_of<value_type> E>
+		requires(not std::is_const_v<Magnitude>)
+		auto operator+=(E const& expression) -> euclidean_vector_view& {
+			if (num_dimensions_ != expression.dimensions()) {
+				detail::throw_dimension_mismatch(num_dimensions_, expression.dimensions());
+			}
+			for (auto i = 0; i < num_dimensions_; i++) {
+				magnitudes_[static_cast<std::size_t>(i)] += expression[i];
+			}
+			return *this;
+		}
+		template<vector_expression_of<value_type> E>
+		requires(not std::is_const_v<Magnitude>)
+		auto operator-=(E const& expression) -> euclidean_vector_view& {
+			if (num_dimensions_ != expression.dimensions()) {
+				detail::throw_dimension_mismatch(num_dimensions_, expression.dimensions());
+			}
+			for (auto i = 0; i < num_dimensions_; i++) {
+				magnitudes_[static_cast<std::size_t>(i)] -= expression[i];
+			}
+			return *this;
+		}
+
+	private:
+		Magnitude* magnitudes_ = nullptr;
+		int num_dimensions_ = 0;
+	};
+
+	template<typename Scalar>
+	euclidean_vector_view(basic_euclidean_vector<Scalar> const&)
+	   -> euclidean_vector_view<Scalar const>;
+	template<typename Magnitude>
+	euclidean_vector_view(Magnitude*, int) -> euclidean_vector_view<Magnitude>;
+	template<typename Magnitude>
+	euclidean_vector_view(std::span<Magnitude>) -> euclidean_vector_view<Magnitude>;
+
+	// at and the compound operations are built once, in the library
+	extern template class euclidean_vector_view<double>;
+	extern template class euclidean_vector_view<double const>;
+	extern template class euclidean_vector_view<float>;
+	extern template class euclidean_vector_view<float const>;
+
+	// element by element lhs op rhs, for + and -
+	template<typename Lhs, typename Rhs, typename Op>
+	class vector_binary_expression {
+	public:
+		using value_type = typename std::remove_cvref_t<Lhs>::value_type;
+
+		vector_binary_expression(Lhs lhs, Rhs rhs)
+		: lhs_(std::forward<Lhs>(lhs))
+		, rhs_(std::forward<Rhs>(rhs)) {
+			if (lhs_.dimensions() != rhs_.dimensions()) {
+				detail::throw_dimension_mismatch(lhs_.dimensions(), rhs_.dimensions());
+			}
+		}
+
+		auto dimensions() const -> int {
+			return lhs_.dimensions();
+		}
+
+		auto operator[](int index) const -> value_type {
+			return Op{}(detail::element(lhs_, index), detail::element(rhs_, index));
+		}
+
+		auto at(int dimension) const -> value_type {
+			return detail::checked_element(*this, dimension);
+		}
+
+		explicit operator std::vector<value_type>() const {
+			return detail::evaluate_into<std::vector<value_type>>(*this);
+		}
+
+		explicit operator std::list<value_type>() const {
+			return detail::evaluate_into<std::list<value_type>>(*this);
+		}
+
+	private:
+		Lhs lhs_;
+		Rhs rhs_;
+	};
+
+	// element by element vector op scalar, for * and /
+	template<typename Vector, typename Op>
+	class vector_scalar_expression {
+	public:
+		using value_type = typename std::remove_cvref_t<Vector>::value_type;
+
+		vector_scalar_expression(Vector vector, value_type scalar)
+		: vector_(std::forward<Vector>(vector))
+		, scalar_(scalar) {}
+
+		auto dimensions() const -> int {
+			return vector_.dimensions();
+		}
+
+		auto operator[](int index) const -> value_type {
+			return Op{}(detail::element(vector_, index), scalar_);
+		}
+
+		auto at(int dimension) const -> value_type {
+			return detail::checked_element(*this, dimension);
+		}
+
+		explicit operator std::vector<value_type>() const {
+			return detail::evaluate_into<std::vector<value_type>>(*this);
+		}
+
+		explicit operator std::list<value_type>() const {
+			return detail::evaluate_into<std::list<value_type>>(*this);
+		}
+
+	private:
+		Vector vector_;
+		value_type scalar_;
+	};
+
+	// an operand as it is, for lazy
+	template<typename Vector>
+	class vector_lazy_operand {
+	public:
+		using value_type = typename std::remove_cvref_t<Vector>::value_type;
+
+		explicit vector_lazy_operand(Vector vector)
+		: vector_(std::forward<Vector>(vector)) {}
+
+		auto dimensions() const -> int {
+			return vector_.dimensions();
+		}
+
+		auto operator[](int index) const -> value_type {
+			return detail::element(vector_, index);
+		}
+
+		auto at(int dimension) const -> value_type {
+			return detail::checked_element(*this, dimension);
+		}
+
+		explicit operator std::vector<value_type>() const {
+			return detail::evaluate_into<std::vector<value_type>>(*this);
+		}
+
+		explicit operator std::list<value_type>() const {
+			return detail::evaluate_into<std::list<value_type>>(*this);
+		}
+
+	private:
+		Vector vector_;
+	};
+
+	template<typename Lhs, typename Rhs, typename Op>
+	inline constexpr bool is_vector_expression<vector_binary_expression<Lhs, Rhs, Op>> = true;
+	template<typename Vector, typename Op>
+	inline constexpr bool is_vector_expression<vector_scalar_expression<Vector, Op>> = true;
+	template<typename Vector>
+	inline constexpr bool is_vector_expression<vector_lazy_operand<Vector>> = true;
+
+	// opts in to fused evaluation: operators on the result give expressions rather than
+	// euclidean_vectors (see the top of this file)
+	template<vector_operand Vector>
+	auto lazy(Vector&& vector) {
+		return vector_lazy_operand<detail::operand_storage<Vector>>(std::forward<Vector>(vector));
+	}
+
+	namespace detail {
+		// how a temporary euclidean_vector operand deduces through Vector&&
+		template<typename T>
+		concept expiring_vector = is_euclidean_vector<T>;
+
+		// the type of an operand's magnitudes
+		template<typename T>
+		using scalar_of = typename std::remove_cvref_t<T>::value_type;
+
+		// what an operator on these operands gives: the expression itself when one of them already
+		// is an expression (the caller opted in with lazy), and otherwise the euclidean_vector it
+		// evaluates to, computed now
+		template<typename... Operands, typename Expression>
+		auto result_of(Expression expression) {
+			if constexpr ((vector_expression<Operands> || ...)) {
+				return expression;
+			}
+			else {
+				return basic_euclidean_vector<typename Expression::value_type>(expression);
+			}
+		}
+	} // namespace detail
+
+	// addition
+	template<vector_operand Lhs, vector_operand Rhs>
+	requires(not detail::expiring_vector<Lhs> && not detail::expiring_vector<Rhs>
+	         && detail::same_scalar<Lhs, Rhs>)
+	auto operator+(Lhs&& first, Rhs&& second) {
+		return detail::result_of<Lhs, Rhs>(
+		   vector_binary_expression<detail::operand_storage<Lhs>,
+		                            detail::operand_storage<Rhs>,
+		                            std::plus<>>(std::forward<Lhs>(first),
+		                                          std::forward<Rhs>(second)));
+	}
+
+	// subtraction
+	template<vector_operand Lhs, vector_operand Rhs>
+	requires(not detail::expiring_vector<Lhs> && not detail::expiring_vector<Rhs>
+	         && detail::same_scalar<Lhs, Rhs>)
+	auto operator-(Lhs&& first, Rhs&& second) {
+		return detail::result_of<Lhs, Rhs>(
+		   vector_binary_expression<detail::operand_storage<Lhs>,
+		                            detail::operand_storage<Rhs>,
+		                            std::minus<>>(std::forward<Lhs>(first),
+		                                           std::forward<Rhs>(second)));
+	}
+
+	// multiply (vector * multiplier and multiplier * vector)
+	template<vector_operand Vector>
+	requires(not detail::expiring_vector<Vector>)
+	auto operator*(Vector&& vector, double multiplier) {
+		return detail::result_of<Vector>(
+		   vector_scalar_expression<detail::operand_storage<Vector>, std::multiplies<>>(
+		      std::forward<Vector>(vector),
+		      static_cast<detail::scalar_of<Vector>>(multiplier)));
+	}
+
+	template<vector_operand Vector>
+	auto operator*(double multiplier, Vector&& vector) {
+		return std::forward<Vector>(vector) * multiplier;
+	}
+
+	// divide
+	template<vector_operand Vector>
+	requires(not detail::expiring_vector<Vector>)
+	auto operator/(Vector&& vector, double divisor) {
+		auto const scalar_divisor = static_cast<detail::scalar_of<Vector>>(divisor);
+		if (scalar_divisor == 0) {
+			throw euclidean_vector_error("Invalid vector division by 0");
+		}
+		return detail::result_of<Vector>(
+		   vector_scalar_expression<detail::operand_storage<Vector>, std::divides<>>(
+		      std::forward<Vector>(vector),
+		      scalar_divisor));
+	}
+
+	// addition and subtraction with a temporary euclidean_vector, computed in its storage. on the
+	// right, it is overwritten with first op second element by element, the same order as the
+	// expressions, so either way the result is what the lazy version would give.
+	template<typename Scalar, vector_operand Rhs>
+	requires detail::same_scalar<basic_euclidean_vector<Scalar>, Rhs>
+	auto operator+(basic_euclidean_vector<Scalar>&& first, Rhs&& second)
+	   -> basic_euclidean_vector<Scalar> {
+		first += second;
+		return std::move(first);
+	}
+
+	template<vector_operand Lhs, typename Scalar>
+	requires(not detail::expiring_vector<Lhs>
+	         && detail::same_scalar<Lhs, basic_euclidean_vector<Scalar>>)
+	auto operator+(Lhs&& first, basic_euclidean_vector<Scalar>&& second)
+	   -> basic_euclidean_vector<Scalar> {
+		second = lazy(first) + second;
+		return std::move(second);
+	}
+
+	template<typename Scalar, vector_operand Rhs>
+	requires detail::same_scalar<basic_euclidean_vector<Scalar>, Rhs>
+	auto operator-(basic_euclidean_vector<Scalar>&& first, Rhs&& second)
+	   -> basic_euclidean_vector<Scalar> {
+		first -= second;
+		return std::move(first);
+	}
+
+	template<vector_operand Lhs, typename Scalar>
+	requires(not detail::expiring_vector<Lhs>
+	         && detail::same_scalar<Lhs, basic_euclidean_vector<Scalar>>)
+	auto operator-(Lhs&& first, basic_euclidean_vector<Scalar>&& second)
+	   -> basic_euclidean_vector<Scalar> {
+		second = lazy(first) - second;
+		return std::move(second);
+	}
+
+	// multiply and divide a temporary euclidean_vector in its storage, with the same kernels as
+	// *= and /= (which do the same single operation per element as the expressions).
+	// multiplier * vector forwards here.
+	template<typename Scalar>
+	auto operator*(basic_euclidean_vector<Scalar>&& vector, double multiplier)
+	   -> basic_euclidean_vector<Scalar> {
+		vector *= static_cast<Scalar>(multiplier);
+		return std::move(vector);
+	}
+
+	template<typename Scalar>
+	auto operator/(basic_euclidean_vector<Scalar>&& vector, double divisor)
+	   -> basic_euclidean_vector<Scalar> {
+		vector /= static_cast<Scalar>(divisor);
+		return std::move(vector);
+	}
+
+	template<typename Scalar>
+	template<vector_scalar Other>
+	requires(not std::same_as<Other, Scalar>)
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(
+	   basic_euclidean_vector<Other> const& vector) {
+		allocate(vector.dimensions());
+		for (auto i = 0; i < num_dimensions_; i++) {
+			magnitudes_[static_cast<std::size_t>(i)] = static_cast<Scalar>(detail::element(vector, i));
+		}
+	}
+
+	template<typename Scalar>
+	template<vector_expression_of<Scalar> E>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(E const& expression) {
+		allocate(expression.dimensions());
+		for (auto i = 0; i < num_dimensions_; i++) {
+			magnitudes_[static_cast<std::size_t>(i)] = expression[i];
+		}
+	}
+
+	// every element only depends on the same index of the operands, so evaluating in place is
+	// safe even when the expression reads this vector (a = b - a)
+	template<typename Scalar>
+	template<vector_expression_of<Scalar> E>
+	auto basic_euclidean_vector<Scalar>::operator=(E const& expression) -> basic_euclidean_vector& {
+		if (expression.dimensions() != num_dimensions_) {
+			return *this = basic_euclidean_vector(expression);
+		}
+		invalidate_norm();
+		for (auto i = 0; i < num_dimensions_; i++) {
+			magnitudes_[static_cast<std::size_t>(i)] = expression[i];
+		}
+		return *this;
+	}
+
+	template<typename Scalar>
+	template<vector_expression_of<Scalar> E>
+	auto basic_euclidean_vector<Scalar>::operator+=(E const& expression) -> basic_euclidean_vector& {
+		if (num_dimensions_ != expression.dimensions()) {
+			detail::throw_dimension_mismatch(num_dimensions_, expression.dimensions());
+		}
+		invalidate_norm();
+		for (auto i = 0; i < num_dimensions_; i++) {
+			magnitudes_[static_cast<std::size_t>(i)] += expression[i];
+		}
+		return *this;
+	}
+
+	template<typename Scalar>
+	template<vector_expression_of<Scalar> E>
+	auto basic_euclidean_vector<Scalar>::operator-=(E const& expression) -> basic_euclidean_vector& {
+		if (num_dimensions_ != expression.dimensions()) {
+			detail::throw_dimension_mismatch(num_dimensions_, expression.dimensions());
+		}
+		invalidate_norm();
+		for (auto i = 0; i < num_dimensions_; i++) {
+			magnitudes_[static_cast<std::size_t>(i)] -= expression[i];
+		}
+		return *this;
+	}
 
 } // namespace comp6771
 #endif // COMP6771_EUCLIDEAN_VECTOR_HPP
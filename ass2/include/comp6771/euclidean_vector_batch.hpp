@@ -0,0 +1,95 @@
+#ifndef COMP6771_EUCLIDEAN_VECTOR_BATCH_HPP
+#define COMP6771_EUCLIDEAN_VECTOR_BATCH_HPP
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+
+namespace comp6771 {
+	// many vectors of the same number of dimensions in one buffer, for similarity workloads. a
+	// std::vector<euclidean_vector> has a heap block and a norm cache per vector scattered over
+	// memory, while a batch keeps its rows back to back, so the batched operations below read
+	// straight through one block and the hardware prefetcher sees a single stream.
+	//
+	// the buffer is aligned to a cache line and every row starts on one: rows are padded to a
+	// multiple of row_alignment doubles (the padding is never read). rows are handed out as
+	// euclidean_vector_views, which work with everything else in this library.
+	class euclidean_vector_batch {
+	public:
+		// bytes each row starts on a multiple of
+		static constexpr std::size_t row_alignment = 64;
+
+		// size vectors of the given dimensions, every magnitude 0. a negative number of dimensions
+		// or size throws a euclidean_vector_error.
+		explicit euclidean_vector_batch(int dimensions, int size = 0);
+
+		euclidean_vector_batch(euclidean_vector_batch const& other);
+		euclidean_vector_batch(euclidean_vector_batch&& other) noexcept;
+		auto operator=(euclidean_vector_batch const& other) -> euclidean_vector_batch&;
+		auto operator=(euclidean_vector_batch&& other) noexcept -> euclidean_vector_batch&;
+		~euclidean_vector_batch() = default;
+
+		// row access (unchecked and checked)
+		auto operator[](int row) -> euclidean_vector_view<double>;
+		auto operator[](int row) const -> euclidean_vector_view<double const>;
+		auto at(int row) -> euclidean_vector_view<double>;
+		auto at(int row) const -> euclidean_vector_view<double const>;
+
+		// appends a copy of vector, which must have dimensions() dimensions
+		auto push_back(euclidean_vector_view<double const> vector) -> void;
+		// makes room for capacity rows without reallocating (a negative capacity throws)
+		auto reserve(int capacity) -> void;
+
+		// every row's magnitudes multiplied or divided by the same scalar
+		auto operator*=(double multiplier) -> euclidean_vector_batch&;
+		auto operator/=(double divisor) -> euclidean_vector_batch&;
+
+		auto size() const noexcept -> int;
+		auto dimensions() const noexcept -> int;
+		// doubles from the start of one row to the next
+		auto stride() const noexcept -> std::size_t;
+
+	private:
+		struct aligned_delete {
+			auto operator()(double* magnitudes) const noexcept -> void {
+				::operator delete[](magnitudes, std::align_val_t{row_alignment});
+			}
+		};
+		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
+		using buffer = std::unique_ptr<double[], aligned_delete>;
+
+		// a zeroed buffer for capacity rows
+		auto allocate(int capacity) const -> buffer;
+		auto row(int index) const noexcept -> double*;
+
+		int dimensions_;
+		int size_;
+		int capacity_;
+		std::size_t stride_;
+		buffer magnitudes_;
+	};
+
+	// each result is the same bits as the one vector function gives for that row, including rows of
+	// parallel_reduction_threshold dimensions or more, which are reduced across threads. results
+	// shorter than the batch throw a euclidean_vector_error before anything is written.
+
+	// results[i] = dot(batch[i], query). results.size() must be at least batch.size().
+	auto dot(euclidean_vector_batch const& batch,
+	         euclidean_vector_view<double const> query,
+	         std::span<double> results) -> void;
+	// results[i] = dot(first[i], second[i]). both batches must have the same size, and
+	// results.size() must be at least that.
+	auto dot(euclidean_vector_batch const& first,
+	         euclidean_vector_batch const& second,
+	         std::span<double> results) -> void;
+	// results[i] = euclidean_norm(batch[i]). results.size() must be at least batch.size().
+	auto euclidean_norms(euclidean_vector_batch const& batch, std::span<double> results) -> void;
+	// replaces every row with its unit vector. rows with a zero norm have none and are left as
+	// they are, rather than throwing halfway through the batch.
+	auto normalize(euclidean_vector_batch& batch) -> void;
+} // namespace comp6771
+
+#endif // COMP6771_EUCLIDEAN_VECTOR_BATCH_HPP
@@ -0,0 +1,227 @@
+#ifndef COMP6771_FIXED_EUCLIDEAN_VECTOR_HPP
+#define COMP6771_FIXED_EUCLIDEAN_VECTOR_HPP
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace comp6771 {
+	// a euclidean_vector whose number of dimensions is part of its type, for 2d/3d/4d geometry and
+	// the like. the magnitudes live in a std::array, nothing allocates, and every operation is
+	// constexpr and inline, so small vector math compiles down to straight line code. adding,
+	// subtracting or dotting vectors of different dimensions does not compile, rather than
+	// throwing.
+	//
+	// the only things that can still throw are at (bad index), / (division by 0), unit (zero
+	// norm) and the conversion from a euclidean_vector of the wrong size.
+	template<std::size_t N>
+	class fixed_euclidean_vector {
+	public:
+		/////// CONSTRUCTORS ////////
+		// every magnitude 0
+		constexpr fixed_euclidean_vector() = default;
+		// every magnitude set to magnitude
+		constexpr explicit fixed_euclidean_vector(double magnitude) {
+			magnitudes_.fill(magnitude);
+		}
+		// one magnitude per dimension: fixed_euclidean_vector<3>{1, 2, 3}. the wrong number of
+		// magnitudes does not compile. (with one dimension, the constructor above does this.)
+		template<std::convertible_to<double>... Magnitudes>
+		requires(sizeof...(Magnitudes) == N && N != 1)
+		constexpr fixed_euclidean_vector(Magnitudes... magnitudes)
+		: magnitudes_{static_cast<double>(magnitudes)...} {}
+		constexpr explicit fixed_euclidean_vector(std::array<double, N> const& magnitudes)
+		: magnitudes_(magnitudes) {}
+		// throws if vector does not have N dimensions
+		explicit fixed_euclidean_vector(euclidean_vector const& vector) {
+			if (vector.dimensions() != dimensions()) {
+				detail::throw_dimension_mismatch(dimensions(), vector.dimensions());
+			}
+			for (auto i = std::size_t{0}; i < N; i++) {
+				magnitudes_[i] = vector[static_cast<int>(i)];
+			}
+		}
+
+		//////// OPERATIONS ///////
+		// subscript (const and non const), unchecked like euclidean_vector's
+		constexpr auto operator[](int index) const -> double {
+			return magnitudes_[static_cast<std::size_t>(index)];
+		}
+		constexpr auto operator[](int index) -> double& {
+			return magnitudes_[static_cast<std::size_t>(index)];
+		}
+		// unary plus
+		constexpr auto operator+() const -> fixed_euclidean_vector {
+			return *this;
+		}
+		// negation
+		constexpr auto operator-() const -> fixed_euclidean_vector {
+			auto negated = fixed_euclidean_vector();
+			for (auto i = std::size_t{0}; i < N; i++) {
+				negated.magnitudes_[i] = -magnitudes_[i];
+			}
+			return negated;
+		}
+		// compound addition
+		constexpr auto operator+=(fixed_euclidean_vector const& vector) -> fixed_euclidean_vector& {
+			for (auto i = std::size_t{0}; i < N; i++) {
+				magnitudes_[i] += vector.magnitudes_[i];
+			}
+			return *this;
+		}
+		// compound subtraction
+		constexpr auto operator-=(fixed_euclidean_vector const& vector) -> fixed_euclidean_vector& {
+			for (auto i = std::size_t{0}; i < N; i++) {
+				magnitudes_[i] -= vector.magnitudes_[i];
+			}
+			return *this;
+		}
+		// compound multiplication
+		constexpr auto operator*=(double multiplier) -> fixed_euclidean_vector& {
+			for (auto& magnitude : magnitudes_) {
+				magnitude *= multiplier;
+			}
+			return *this;
+		}
+		// compound division
+		constexpr auto operator/=(double divisor) -> fixed_euclidean_vector& {
+			if (divisor == 0) {
+				throw euclidean_vector_error("Invalid vector division by 0");
+			}
+			for (auto& magnitude : magnitudes_) {
+				magnitude /= divisor;
+			}
+			return *this;
+		}
+		// euclidean_vector type conversion
+		explicit operator euclidean_vector() const {
+			auto vector = euclidean_vector(dimensions());
+			for (auto i = std::size_t{0}; i < N; i++) {
+				vector[static_cast<int>(i)] = magnitudes_[i];
+			}
+			return vector;
+		}
+		// array type conversion
+		constexpr explicit operator std::array<double, N>() const {
+			return magnitudes_;
+		}
+
+		///// MEMBER FUNCTIONS ///////
+		constexpr auto at(int dimension) const -> double {
+			check_index(dimension);
+			return magnitudes_[static_cast<std::size_t>(dimension)];
+		}
+		constexpr auto at(int dimension) -> double& {
+			check_index(dimension);
+			return magnitudes_[static_cast<std::size_t>(dimension)];
+		}
+		static constexpr auto dimensions() -> int {
+			return static_cast<int>(N);
+		}
+
+		/////// FRIENDS /////////
+		// equal
+		friend constexpr auto
+		operator==(fixed_euclidean_vector const& first, fixed_euclidean_vector const& second)
+		   -> bool = default;
+		// addition
+		friend constexpr auto
+		operator+(fixed_euclidean_vector first, fixed_euclidean_vector const& second)
+		   -> fixed_euclidean_vector {
+			return first += second;
+		}
+		// subtraction
+		friend constexpr auto
+		operator-(fixed_euclidean_vector first, fixed_euclidean_vector const& second)
+		   -> fixed_euclidean_vector {
+			return first -= second;
+		}
+		// multiply (vector * multiplier and multiplier * vector)
+		friend constexpr auto operator*(fixed_euclidean_vector vector, double multiplier)
+		   -> fixed_euclidean_vector {
+			return vector *= multiplier;
+		}
+		friend constexpr auto operator*(double multiplier, fixed_euclidean_vector vector)
+		   -> fixed_euclidean_vector {
+			return vector *= multiplier;
+		}
+		// divide
+		friend constexpr auto operator/(fixed_euclidean_vector vector, double divisor)
+		   -> fixed_euclidean_vector {
+			return vector /= divisor;
+		}
+		// output stream, in the same format as euclidean_vector
+		friend auto operator<<(std::ostream& output, fixed_euclidean_vector const& vector)
+		   -> std::ostream& {
+			output << "[";
+			for (auto i = std::size_t{0}; i < N; i++) {
+				if (i != 0) {
+					output << " ";
+				}
+				output << vector.magnitudes_[i];
+			}
+			output << "]";
+			return output;
+		}
+
+	private:
+		static constexpr auto check_index(int dimension) -> void {
+			if (dimension < 0 || dimension >= dimensions()) {
+				throw euclidean_vector_error("Index " + std::to_string(dimension)
+				                             + " is not valid for this euclidean_vector object");
+			}
+		}
+
+		std::array<double, N> magnitudes_{};
+	};
+
+	// adding, subtracting or dotting vectors of different sizes does not compile. the friend
+	// operators only take matching sizes anyway, and these make the error name both sizes.
+	template<std::size_t N, std::size_t M>
+	requires(N != M)
+	auto operator+(fixed_euclidean_vector<N> const&, fixed_euclidean_vector<M> const&) -> void = delete;
+	template<std::size_t N, std::size_t M>
+	requires(N != M)
+	auto operator-(fixed_euclidean_vector<N> const&, fixed_euclidean_vector<M> const&) -> void = delete;
+	template<std::size_t N, std::size_t M>
+	requires(N != M)
+	auto dot(fixed_euclidean_vector<N> const&, fixed_euclidean_vector<M> const&) -> void = delete;
+
+	/////// UTILITY FUNCTIONS ///////
+	template<std::size_t N>
+	constexpr auto
+	dot(fixed_euclidean_vector<N> const& first, fixed_euclidean_vector<N> const& second) -> double {
+		auto product = 0.0;
+		for (auto i = 0; i < fixed_euclidean_vector<N>::dimensions(); i++) {
+			product += first[i] * second[i];
+		}
+		return product;
+	}
+
+	// not constexpr, since std::sqrt is not
+	template<std::size_t N>
+	auto euclidean_norm(fixed_euclidean_vector<N> const& vector) -> double {
+		return std::sqrt(dot(vector, vector));
+	}
+
+	template<std::size_t N>
+	auto unit(fixed_euclidean_vector<N> const& vector) -> fixed_euclidean_vector<N> {
+		if constexpr (N == 0) {
+			throw euclidean_vector_error("euclidean_vector with no dimensions does not have a unit "
+			                             "vector");
+		}
+		auto const normal = euclidean_norm(vector);
+		if (normal == 0) {
+			throw euclidean_vector_error("euclidean_vector with zero euclidean normal does not have a "
+			                             "unit vector");
+		}
+		return vector / normal;
+	}
+} // namespace comp6771
+
+#endif // COMP6771_FIXED_EUCLIDEAN_VECTOR_HPP
@@ -0,0 +1,49 @@
+#ifndef COMP6771_PARALLEL_REDUCTION_HPP
+#define COMP6771_PARALLEL_REDUCTION_HPP
+
+#include <cstddef>
+
+// dot, euclidean_norm, extended_dot and extended_euclidean_norm switch to the parallel reductions
+// at this many dimensions. set project wide (the EUCLIDEAN_VECTOR_PARALLEL_THRESHOLD cmake cache
+// variable), like the inline capacity, so that the library and its users agree on it.
+#ifndef COMP6771_PARALLEL_REDUCTION_THRESHOLD
+#define COMP6771_PARALLEL_REDUCTION_THRESHOLD 2097152
+#endif
+
+namespace comp6771 {
+	// dot and sum_of_squares (and their extended versions) of arrays long enough that one core is
+	// the limit, such as vectors with tens of millions of dimensions.
+	//
+	// the array is cut into blocks of reduction_block elements, however many threads there are.
+	// the threads take blocks in turn and reduce each one with the kernels, and the block sums are
+	// then combined like the kernels' partial sums, neighbours pairwise, in block order. so the
+	// result is the same bits for any number of threads (including 1), and its rounding error grows
+	// with the length of a block and the log of the number of blocks, not with the length of the
+	// array. it is not the result of the serial kernel, which adds each partial sum all the way
+	// along the array.
+	inline constexpr auto reduction_block = std::size_t{1024};
+	inline constexpr auto parallel_reduction_threshold =
+	   std::size_t{COMP6771_PARALLEL_REDUCTION_THRESHOLD};
+
+	// threads == 0 means std::thread::hardware_concurrency(). built for float and double.
+	template<typename Scalar>
+	[[nodiscard]] auto parallel_dot(Scalar const* first,
+	                                Scalar const* second,
+	                                std::size_t size,
+	                                unsigned threads = 0) -> Scalar;
+	template<typename Scalar>
+	[[nodiscard]] auto parallel_sum_of_squares(Scalar const* values,
+	                                           std::size_t size,
+	                                           unsigned threads = 0) -> Scalar;
+	template<typename Scalar>
+	[[nodiscard]] auto parallel_extended_dot(Scalar const* first,
+	                                         Scalar const* second,
+	                                         std::size_t size,
+	                                         unsigned threads = 0) -> double;
+	template<typename Scalar>
+	[[nodiscard]] auto parallel_extended_sum_of_squares(Scalar const* values,
+	                                                    std::size_t size,
+	                                                    unsigned threads = 0) -> double;
+} // namespace comp6771
+
+#endif // COMP6771_PARALLEL_REDUCTION_HPP
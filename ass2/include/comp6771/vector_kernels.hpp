@@ -0,0 +1,55 @@
+#ifndef COMP6771_VECTOR_KERNELS_HPP
+#define COMP6771_VECTOR_KERNELS_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace comp6771 {
+	// the loops behind dot, euclidean_norm, +=, -=, *= and /=, over raw arrays of doubles or
+	// floats. each has a portable scalar version and, on x86, sse2, avx2 and avx-512 versions; the
+	// widest one the cpu supports is picked the first time a kernel runs.
+	//
+	// every version gives bit for bit the same results. the element by element kernels do the same
+	// single operation per element whatever the width. the reductions (dot and sum_of_squares) add
+	// into as many partial sums as one avx-512 register holds (8 doubles or 16 floats), element i
+	// going to sum i % lanes, and then combine neighbouring sums pairwise, as
+	// ((s0 + s1) + (s2 + s3)) + ((s4 + s5) + (s6 + s7)) for doubles. that is what one avx-512
+	// register, two avx2 registers, four sse2 registers and the scalar loop all do. no fused
+	// multiply-add is used, since it rounds differently.
+	enum class simd_level { scalar, sse2, avx2, avx512 };
+
+	template<typename Scalar>
+	struct basic_vector_kernels {
+		Scalar (*dot)(Scalar const* first, Scalar const* second, std::size_t size);
+		Scalar (*sum_of_squares)(Scalar const* values, std::size_t size);
+		// values[i] += others[i]
+		void (*add)(Scalar* values, Scalar const* others, std::size_t size);
+		// values[i] -= others[i]
+		void (*subtract)(Scalar* values, Scalar const* others, std::size_t size);
+		// values[i] *= multiplier
+		void (*multiply)(Scalar* values, Scalar multiplier, std::size_t size);
+		// values[i] /= divisor (a real division, not a multiplication by 1 / divisor)
+		void (*divide)(Scalar* values, Scalar divisor, std::size_t size);
+		// dot and sum_of_squares accumulated in double, into 8 partial sums like the double
+		// kernels. a product of two floats is exact in double, so for floats only the additions
+		// round. for doubles these are dot and sum_of_squares.
+		double (*extended_dot)(Scalar const* first, Scalar const* second, std::size_t size);
+		double (*extended_sum_of_squares)(Scalar const* values, std::size_t size);
+	};
+
+	using vector_kernels = basic_vector_kernels<double>;
+
+	// the kernels for the best level this cpu supports
+	[[nodiscard]] auto kernels() -> vector_kernels const&;
+	// the kernels for the given level. only call this with a supported level.
+	[[nodiscard]] auto kernels(simd_level level) -> vector_kernels const&;
+	// the same for either scalar type (kernels<double>() is kernels()). built for float and double.
+	template<typename Scalar>
+	[[nodiscard]] auto kernels() -> basic_vector_kernels<Scalar> const&;
+	template<typename Scalar>
+	[[nodiscard]] auto kernels(simd_level level) -> basic_vector_kernels<Scalar> const&;
+	// every level this cpu supports, from scalar up
+	[[nodiscard]] auto supported_simd_levels() -> std::vector<simd_level>;
+} // namespace comp6771
+
+#endif // COMP6771_VECTOR_KERNELS_HPP
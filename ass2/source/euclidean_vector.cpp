@@ -1,161 +1,166 @@
 // Copyright (c) Christopher Di Bella.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
-#include <asm-generic/errno.h>
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <comp6771/euclidean_vector.hpp>
+#include <comp6771/parallel_reduction.hpp>
+#include <comp6771/vector_kernels.hpp>
+#include <memory>
 #include <ostream>
+#include <string>
+#include <utility>
 
 namespace comp6771 {
 	//////////// CONSTRUCTORS ////////////////
 	// default constructor
-	euclidean_vector::euclidean_vector() {
-		this->find_normal = true;
-		this->normal = 0;
-		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
-		this->magnitudes_ = std::make_unique<double[]>(1);
-		this->num_dimensions_ = 1;
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector() {
+		this->allocate(1);
+		this->magnitudes_[0] = 0.0;
 	}
 
 	// single-argument constructor
-	euclidean_vector::euclidean_vector(int num_dimensions) {
-		this->find_normal = true;
-		this->normal = 0;
-		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
-		this->magnitudes_ = std::make_unique<double[]>(static_cast<size_t>(num_dimensions));
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(int num_dimensions) {
+		this->allocate(num_dimensions);
 		// sets mag in each direction to 0.0
 		for (int i = 0; i < num_dimensions; i++) {
 			this->magnitudes_[static_cast<size_t>(i)] = 0.0;
 		}
-		this->num_dimensions_ = num_dimensions;
 	}
 
 	// constructor
 	// (not sure how to remove clang for this, since it is what the spec gave
 	// clang error: bugprone easily swappable params)
-	euclidean_vector::euclidean_vector(int num_dimensions, double magnitude) {
-		this->find_normal = true;
-		this->normal = 0;
-		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
-		this->magnitudes_ = std::make_unique<double[]>(static_cast<size_t>(num_dimensions));
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(int num_dimensions, Scalar magnitude) {
+		this->allocate(num_dimensions);
 		for (int i = 0; i < num_dimensions; i++) {
 			this->magnitudes_[static_cast<size_t>(i)] = magnitude;
 		}
-		this->num_dimensions_ = num_dimensions;
 	}
 
 	// constructor
-	euclidean_vector::euclidean_vector(std::vector<double>::const_iterator begin_iterator,
-	                                   std::vector<double>::const_iterator end_iterator) {
-		this->find_normal = true;
-		this->normal = 0;
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(
+	   typename std::vector<Scalar>::const_iterator begin_iterator,
+	   typename std::vector<Scalar>::const_iterator end_iterator) {
 		// get num dimensions based on number of iterators from begin iter to end iter
 		int num_dimensions = 0;
 		for (auto iter = begin_iterator; iter != end_iterator; iter++) {
 			num_dimensions++;
 		}
-		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
-		this->magnitudes_ = std::make_unique<double[]>(static_cast<size_t>(num_dimensions));
+		this->allocate(num_dimensions);
 		int index = 0;
 		for (auto iter = begin_iterator; iter != end_iterator; iter++) {
 			this->magnitudes_[static_cast<size_t>(index)] = *iter;
 			index++;
 		}
-		this->num_dimensions_ = num_dimensions;
 	}
 
 	// constructor
-	euclidean_vector::euclidean_vector(std::initializer_list<double> init_list) {
-		this->find_normal = true;
-		this->normal = 0;
-		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
-		this->magnitudes_ = std::make_unique<double[]>(static_cast<size_t>(init_list.size()));
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(std::initializer_list<Scalar> init_list) {
+		this->allocate(static_cast<int>(init_list.size()));
 		int num_dimensions = 0;
 		for (auto iter : init_list) {
 			this->magnitudes_[static_cast<size_t>(num_dimensions)] = iter;
 			num_dimensions++;
 		}
-		this->num_dimensions_ = num_dimensions;
+	}
+
+	// copy of the magnitudes a view looks at
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(
+	   euclidean_vector_view<Scalar const> view) {
+		this->allocate(view.dimensions());
+		std::copy_n(view.data(), view.dimensions(), this->magnitudes_);
 	}
 
 	// copy constructor
-	euclidean_vector::euclidean_vector(euclidean_vector const& src_vector) noexcept {
-		this->find_normal = src_vector.find_normal;
-		this->normal = src_vector.normal;
-		// NOLINTNEXTLINE(modernize-avoid-c-arrays)
-		this->magnitudes_ = std::make_unique<double[]>(static_cast<size_t>(src_vector.dimensions()));
-		for (int i = 0; i < src_vector.dimensions(); i++) {
-			magnitudes_[static_cast<size_t>(i)] = src_vector.magnitudes_[static_cast<size_t>(i)];
-		}
-		this->num_dimensions_ = src_vector.dimensions();
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(
+	   basic_euclidean_vector const& src_vector) noexcept {
+		this->norm_.store(src_vector.norm_.load(std::memory_order_relaxed),
+		                  std::memory_order_relaxed);
+		this->allocate(src_vector.dimensions());
+		std::copy_n(src_vector.magnitudes_, src_vector.dimensions(), this->magnitudes_);
 	}
 
 	// move constructor
-	euclidean_vector::euclidean_vector(euclidean_vector&& src_vector) noexcept {
-		this->find_normal = std::exchange(src_vector.find_normal, true);
-		this->normal = std::exchange(src_vector.normal, 0);
-		this->magnitudes_ = std::exchange(src_vector.magnitudes_, nullptr);
-		this->num_dimensions_ = std::exchange(src_vector.num_dimensions_, 0);
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::basic_euclidean_vector(
+	   basic_euclidean_vector&& src_vector) noexcept {
+		this->norm_.store(src_vector.norm_.exchange(norm_not_cached, std::memory_order_relaxed),
+		                  std::memory_order_relaxed);
+		this->take(src_vector);
 	}
 
 	// deconstructor
-	euclidean_vector::~euclidean_vector() = default;
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::~basic_euclidean_vector() = default;
 
 	////////////////// OPERATIONS ///////////////////
-	// copy assignment
-	auto euclidean_vector::operator=(euclidean_vector const& orig) -> euclidean_vector& {
-		auto copy = orig;
-		std::swap(find_normal, copy.find_normal);
-		std::swap(normal, copy.normal);
-		std::swap(magnitudes_, copy.magnitudes_);
-		std::swap(num_dimensions_, copy.num_dimensions_);
+	// copy assignment (reuses the current storage when the dimensions match)
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator=(basic_euclidean_vector const& orig)
+	   -> basic_euclidean_vector& {
+		if (this == &orig) {
+			return *this;
+		}
+		if (this->num_dimensions_ != orig.num_dimensions_) {
+			this->allocate(orig.num_dimensions_);
+		}
+		std::copy_n(orig.magnitudes_, orig.num_dimensions_, this->magnitudes_);
+		this->norm_.store(orig.norm_.load(std::memory_order_relaxed), std::memory_order_relaxed);
 		return *this;
 	}
 
 	// move assignment
-	auto euclidean_vector::operator=(euclidean_vector&& orig) noexcept -> euclidean_vector& {
-		std::swap(find_normal, orig.find_normal);
-		std::swap(normal, orig.normal);
-		std::swap(magnitudes_, orig.magnitudes_);
-		std::swap(num_dimensions_, orig.num_dimensions_);
-		auto* temp = orig.magnitudes_.release();
-		delete[] temp;
-		// reset all to default after release and deletion
-		// (move requires deletion of old euclidean vector)
-		orig.find_normal = true;
-		orig.normal = 0;
-		orig.magnitudes_ = nullptr;
-		orig.num_dimensions_ = 0;
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator=(basic_euclidean_vector&& orig) noexcept
+	   -> basic_euclidean_vector& {
+		if (this == &orig) {
+			return *this;
+		}
+		this->norm_.store(orig.norm_.exchange(norm_not_cached, std::memory_order_relaxed),
+		                  std::memory_order_relaxed);
+		this->take(orig);
 		return *this;
 	}
 
 	// subscript (const)
-	auto euclidean_vector::operator[](int index) const -> double {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator[](int index) const -> Scalar {
 		// check if index in range
-		assert(index >= 0 && index < static_cast<int>(sizeof(this->magnitudes_)));
+		assert(index >= 0 && index < this->num_dimensions_);
 		return magnitudes_[static_cast<size_t>(index)];
 	}
 
 	// subscript (non-const)
-	auto euclidean_vector::operator[](int index) -> double& {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator[](int index) -> Scalar& {
 		// normal need to be recalculated since euclidean vector changed
-		this->find_normal = true;
+		this->invalidate_norm();
 		// check if index in range
-		assert(index >= 0 && index < static_cast<int>(sizeof(this->magnitudes_)));
+		assert(index >= 0 && index < this->num_dimensions_);
 		return magnitudes_[static_cast<size_t>(index)];
 	}
 
 	// unary plus (returns copy of curr obj)
-	auto euclidean_vector::operator+() -> euclidean_vector {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator+() -> basic_euclidean_vector {
 		// get magnitude, then pass into constructor and then return created object
 		auto magnitudes = this->magnitudes();
-		euclidean_vector return_vector = euclidean_vector(magnitudes.begin(), magnitudes.end());
+		auto return_vector = basic_euclidean_vector(magnitudes.begin(), magnitudes.end());
 		return return_vector;
 	}
 
 	// negation
-	auto euclidean_vector::operator-() -> euclidean_vector {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator-() const& -> basic_euclidean_vector {
 		// (euclidean norm for negated euclidean vector is the same as original, so no recalculation
 		// required)
 		// get magnitude, then pass into constructor and then return created object
@@ -164,72 +169,112 @@ namespace comp6771 {
 		for (auto& magnitude : magnitudes) {
 			magnitude = magnitude * -1;
 		}
-		euclidean_vector return_vector = euclidean_vector(magnitudes.begin(), magnitudes.end());
+		auto return_vector = basic_euclidean_vector(magnitudes.begin(), magnitudes.end());
 		return return_vector;
 	}
 
+	// negation of a temporary, in its own storage. the norm does not change, so a cached one is
+	// kept.
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator-() && -> basic_euclidean_vector {
+		kernels<Scalar>().multiply(this->magnitudes_, -1, static_cast<size_t>(this->dimensions()));
+		return std::move(*this);
+	}
+
 	// compound addition
-	auto euclidean_vector::operator+=(euclidean_vector const& vector) -> euclidean_vector& {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator+=(basic_euclidean_vector const& vector)
+	   -> basic_euclidean_vector& {
 		// normal need to be recalculated since euclidean vector changed
-		this->find_normal = true;
+		this->invalidate_norm();
 		// throw exception if different dimension vectors
 		if (this->dimensions() != vector.dimensions()) {
 			throw euclidean_vector_error("Dimensions of LHS(" + std::to_string(this->dimensions())
 			                             + ") and RHS(" + std::to_string(vector.dimensions())
 			                             + ") do not match");
 		}
-		// loop through all magnitudes and add pairs up with same index
-		for (int i = 0; i < this->dimensions(); i++) {
-			this->magnitudes_[static_cast<size_t>(i)] += vector.magnitudes_[static_cast<size_t>(i)];
-		}
+		// add pairs up with same index (simd kernel)
+		kernels<Scalar>().add(this->magnitudes_,
+		                      vector.magnitudes_,
+		                      static_cast<size_t>(this->dimensions()));
 		return *this;
 	}
 
 	// compound subtraction
-	auto euclidean_vector::operator-=(euclidean_vector const& vector) -> euclidean_vector& {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator-=(basic_euclidean_vector const& vector)
+	   -> basic_euclidean_vector& {
 		// normal need to be recalculated since euclidean vector changed
-		this->find_normal = true;
+		this->invalidate_norm();
 		// throw exception if different dimension vectors
 		if (this->dimensions() != vector.dimensions()) {
 			throw euclidean_vector_error("Dimensions of LHS(" + std::to_string(this->dimensions())
 			                             + ") and RHS(" + std::to_string(vector.dimensions())
 			                             + ") do not match");
 		}
-		// loop through all magnitudes and add pairs up with same index
-		for (int i = 0; i < this->dimensions(); i++) {
-			this->magnitudes_[static_cast<size_t>(i)] -= vector.magnitudes_[static_cast<size_t>(i)];
+		// subtract pairs with same index (simd kernel)
+		kernels<Scalar>().subtract(this->magnitudes_,
+		                           vector.magnitudes_,
+		                           static_cast<size_t>(this->dimensions()));
+		return *this;
+	}
+
+	// compound addition and subtraction of a view
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator+=(euclidean_vector_view<Scalar const> view)
+	   -> basic_euclidean_vector& {
+		this->invalidate_norm();
+		if (this->dimensions() != view.dimensions()) {
+			detail::throw_dimension_mismatch(this->dimensions(), view.dimensions());
+		}
+		kernels<Scalar>().add(this->magnitudes_,
+		                      view.data(),
+		                      static_cast<size_t>(this->dimensions()));
+		return *this;
+	}
+
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator-=(euclidean_vector_view<Scalar const> view)
+	   -> basic_euclidean_vector& {
+		this->invalidate_norm();
+		if (this->dimensions() != view.dimensions()) {
+			detail::throw_dimension_mismatch(this->dimensions(), view.dimensions());
 		}
+		kernels<Scalar>().subtract(this->magnitudes_,
+		                           view.data(),
+		                           static_cast<size_t>(this->dimensions()));
 		return *this;
 	}
 
 	// compound multiplication
-	auto euclidean_vector::operator*=(double multiplier) -> euclidean_vector& {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator*=(Scalar multiplier) -> basic_euclidean_vector& {
 		// normal need to be recalculated since euclidean vector changed
-		this->find_normal = true;
-		// loop through and multiply all magnitudes by mult_val
-		for (auto i = 0; i < this->dimensions(); i++) {
-			this->magnitudes_[static_cast<size_t>(i)] *= multiplier;
-		}
+		this->invalidate_norm();
+		// multiply all magnitudes by multiplier (simd kernel)
+		kernels<Scalar>().multiply(this->magnitudes_,
+		                           multiplier,
+		                           static_cast<size_t>(this->dimensions()));
 		return *this;
 	}
 
 	// compound division
-	auto euclidean_vector::operator/=(double divisor) -> euclidean_vector& {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::operator/=(Scalar divisor) -> basic_euclidean_vector& {
 		// normal need to be recalculated since euclidean vector changed
-		this->find_normal = true;
-		if (divisor == 0.0) {
-			throw "Invalid vector division by 0";
-		}
-		for (auto i = 0; i < this->dimensions(); i++) {
-			this->magnitudes_[static_cast<size_t>(i)] /= divisor;
+		this->invalidate_norm();
+		if (divisor == 0) {
+			throw euclidean_vector_error("Invalid vector division by 0");
 		}
+		kernels<Scalar>().divide(this->magnitudes_, divisor, static_cast<size_t>(this->dimensions()));
 		return *this;
 	}
 
 	// vector type conversion (const) (typecasting to std::vector)
-	euclidean_vector::operator std::vector<double>() const {
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::operator std::vector<Scalar>() const {
 		// initialisation
-		auto return_vector = std::vector<double>();
+		auto return_vector = std::vector<Scalar>();
 		// allocate space for return vector
 		return_vector.reserve(static_cast<size_t>(this->dimensions()));
 		// loop through and add all magnitudes to return vector, then return it.
@@ -240,9 +285,10 @@ namespace comp6771 {
 	}
 
 	// vector type conversion (non-const) (typecasting to std::vector)
-	euclidean_vector::operator std::vector<double>() {
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::operator std::vector<Scalar>() {
 		// initialisation
-		auto return_vector = std::vector<double>();
+		auto return_vector = std::vector<Scalar>();
 		// allocate space for return vector
 		return_vector.reserve(static_cast<size_t>(this->dimensions()));
 		// loop through and add all magnitudes to return vector, then return it.
@@ -253,9 +299,10 @@ namespace comp6771 {
 	}
 
 	// list type conversion (const) (typecasting to std::list)
-	euclidean_vector::operator std::list<double>() const {
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::operator std::list<Scalar>() const {
 		// initialisation
-		auto return_list = std::list<double>();
+		auto return_list = std::list<Scalar>();
 		// loop through and add all magnitudes to return list, then retun it.
 		for (auto magnitude : this->magnitudes()) {
 			return_list.push_back(magnitude);
@@ -264,9 +311,10 @@ namespace comp6771 {
 	}
 
 	// list type conversion (non-const) (typecasting to std::list)
-	euclidean_vector::operator std::list<double>() {
+	template<typename Scalar>
+	basic_euclidean_vector<Scalar>::operator std::list<Scalar>() {
 		// initialisation
-		auto return_list = std::list<double>();
+		auto return_list = std::list<Scalar>();
 		// loop through and add all magnitudes to return list, then retun it.
 		for (auto magnitude : this->magnitudes()) {
 			return_list.push_back(magnitude);
@@ -276,7 +324,8 @@ namespace comp6771 {
 
 	/////// MEMBER FUNCTIONS ///////
 	// return the value of the magnitude in the dimension given by param (const)
-	auto euclidean_vector::at(int dimension) const -> double {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::at(int dimension) const -> Scalar {
 		// exception if given dimension index out of range
 		if (dimension < 0 || dimension >= this->dimensions()) {
 			throw euclidean_vector_error("Index " + std::to_string(dimension)
@@ -287,245 +336,544 @@ namespace comp6771 {
 	}
 
 	// return the value of the magnitude in the dimension given by param (non-const)
-	auto euclidean_vector::at(int dimension) -> double& {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::at(int dimension) -> Scalar& {
 		// exception if given dimension index out of range
 		if (dimension < 0 || dimension >= this->dimensions()) {
 			throw euclidean_vector_error("Index " + std::to_string(dimension)
 			                             + " is not valid for this euclidean_vector object");
 		}
+		// normal need to be recalculated, since the magnitude may be changed through the reference
+		this->invalidate_norm();
 		// if no exception then return magnitude of given dimension index
 		return this->magnitudes_[static_cast<size_t>(dimension)];
 	}
 
 	// return the number of dimensions in a particular euclidean_vector
-	auto euclidean_vector::dimensions() const -> int {
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::dimensions() const -> int {
 		return this->num_dimensions_;
 	}
 
 	///////// FRIENDS /////////////
-	// equal
-	auto operator==(euclidean_vector const& first, euclidean_vector const& second) -> bool {
-		// if dimensions are not equal, return false
-		if (first.dimensions() != second.dimensions()) {
-			return false;
-		}
-		// loop and check if magnitude of all dimensions are equal
-		for (auto i = 0; i < first.dimensions(); i++) {
-			if (first.magnitudes()[static_cast<size_t>(i)] != second.magnitudes_[static_cast<size_t>(i)])
-			{
-				return false;
+	// (only the public interface is needed, so these are not friends. each is written once here
+	// and the overloads for doubles and floats below call it)
+	namespace {
+		// equal, compared in place through views rather than through copies of the magnitudes
+		template<typename Scalar>
+		auto equal(basic_euclidean_vector<Scalar> const& first,
+		           basic_euclidean_vector<Scalar> const& second) -> bool {
+			return euclidean_vector_view<Scalar const>(first)
+			       == euclidean_vector_view<Scalar const>(second);
+		}
+
+		// not equal
+		template<typename Scalar>
+		auto not_equal(basic_euclidean_vector<Scalar> const& first,
+		               basic_euclidean_vector<Scalar> const& second) -> bool {
+			return !equal(first, second);
+		}
+
+		// output stream
+		template<typename Scalar>
+		auto print(std::ostream& output, basic_euclidean_vector<Scalar> const& vector)
+		   -> std::ostream& {
+			// follow given output format, [ at the start, magnitudes with space in between then ] at
+			// the end
+			auto vector_magnitudes = vector.magnitudes();
+			output << "[";
+			auto counter = 0;
+			for (auto magnitude : vector_magnitudes) {
+				if (counter != 0) {
+					output << " ";
+				}
+				output << magnitude;
+				counter++;
 			}
+			output << "]";
+			return output;
 		}
-		// if dimensions equal and all magnitudes equal, return true
-		return true;
+	} // namespace
+
+	auto operator==(euclidean_vector const& first, euclidean_vector const& second) -> bool {
+		return equal(first, second);
+	}
+
+	auto operator==(basic_euclidean_vector<float> const& first,
+	                basic_euclidean_vector<float> const& second) -> bool {
+		return equal(first, second);
 	}
 
-	// not equal
 	auto operator!=(euclidean_vector const& first, euclidean_vector const& second) -> bool {
-		// if dimensions are not equal, return true
-		if (first.dimensions() != second.dimensions()) {
-			return true;
-		}
-		// loop and check if magnitude of all dimensions are equal
-		for (auto i = 0; i < first.dimensions(); i++) {
-			if (first.magnitudes()[static_cast<size_t>(i)]
-			    != second.magnitudes()[static_cast<size_t>(i)]) {
-				return true;
+		return not_equal(first, second);
+	}
+
+	auto operator!=(basic_euclidean_vector<float> const& first,
+	                basic_euclidean_vector<float> const& second) -> bool {
+		return not_equal(first, second);
+	}
+
+	auto operator<<(std::ostream& output, euclidean_vector const& vector) -> std::ostream& {
+		return print(output, vector);
+	}
+
+	auto operator<<(std::ostream& output, basic_euclidean_vector<float> const& vector)
+	   -> std::ostream& {
+		return print(output, vector);
+	}
+
+	// (addition, subtraction, multiply and divide are expression templates in the header; this is
+	// the one piece of them that builds a string)
+	[[noreturn]] auto detail::throw_dimension_mismatch(int lhs, int rhs) -> void {
+		throw euclidean_vector_error("Dimensions of LHS(" + std::to_string(lhs) + ") and RHS("
+		                             + std::to_string(rhs) + ") do not match");
+	}
+
+	////// UTILITY FUNCTIONS ///////
+	namespace {
+		// the reductions: the serial kernels, or across threads from parallel_reduction_threshold
+		// dimensions on
+		template<typename Scalar>
+		auto reduce_dot(Scalar const* first, Scalar const* second, size_t size) -> Scalar {
+			if (size >= parallel_reduction_threshold) {
+				return parallel_dot(first, second, size);
 			}
+			return kernels<Scalar>().dot(first, second, size);
 		}
-		// if dimensions equal and all magnitudes equal, return false
-		return false;
-	}
 
-	// addition
-	auto operator+(euclidean_vector const& first, euclidean_vector const& second) -> euclidean_vector {
-		if (first.dimensions() != second.dimensions()) {
-			throw euclidean_vector_error("Dimensions of LHS(" + std::to_string(first.dimensions())
-			                             + ") and RHS(" + std::to_string(second.dimensions())
-			                             + ") do not match");
+		template<typename Scalar>
+		auto reduce_sum_of_squares(Scalar const* values, size_t size) -> Scalar {
+			if (size >= parallel_reduction_threshold) {
+				return parallel_sum_of_squares(values, size);
+			}
+			return kernels<Scalar>().sum_of_squares(values, size);
 		}
-		auto first_magnitudes = first.magnitudes();
-		auto second_magnitudes = second.magnitudes();
-		auto result_magnitudes = std::vector<double>();
-		// loop through first and second's magnitudes and add, then store in result_magnitudes
-		for (auto i = 0; i < first.dimensions(); i++) {
-			result_magnitudes.push_back(first_magnitudes[static_cast<size_t>(i)]
-			                            + second_magnitudes[static_cast<size_t>(i)]);
+
+		template<typename Scalar>
+		auto reduce_extended_dot(Scalar const* first, Scalar const* second, size_t size) -> double {
+			if (size >= parallel_reduction_threshold) {
+				return parallel_extended_dot(first, second, size);
+			}
+			return kernels<Scalar>().extended_dot(first, second, size);
 		}
-		euclidean_vector retval(result_magnitudes.begin(), result_magnitudes.end());
-		return retval;
-	}
 
-	// subtraction
-	auto operator-(euclidean_vector const& first, euclidean_vector const& second) -> euclidean_vector {
-		// dimensions dont match, throw exception
-		if (first.dimensions() != second.dimensions()) {
-			throw euclidean_vector_error("Dimensions of LHS(" + std::to_string(first.dimensions())
-			                             + ") and RHS(" + std::to_string(second.dimensions())
-			                             + ") do not match");
+		template<typename Scalar>
+		auto reduce_extended_sum_of_squares(Scalar const* values, size_t size) -> double {
+			if (size >= parallel_reduction_threshold) {
+				return parallel_extended_sum_of_squares(values, size);
+			}
+			return kernels<Scalar>().extended_sum_of_squares(values, size);
 		}
-		// return 0 dimensions with 0 magnitude if both dimensions are equal and are equal to 0.
-		if (first.dimensions() == 0) {
-			euclidean_vector retval(0, 0.0);
-			return retval;
-		}
-		auto first_magnitudes = first.magnitudes();
-		auto second_magnitudes = second.magnitudes();
-		auto result_magnitudes = std::vector<double>();
-		// loop through first and second's magnitudes and subtract, then store in result_magnitudes
-		for (auto i = 0; i < first.dimensions(); i++) {
-			result_magnitudes.push_back(first_magnitudes[static_cast<size_t>(i)]
-			                            - second_magnitudes[static_cast<size_t>(i)]);
-		}
-		euclidean_vector retval(result_magnitudes.begin(), result_magnitudes.end());
-		return retval;
-	}
-
-	// multiply (vector * multiplier) case
-	auto operator*(euclidean_vector const& vector, double multiplier) -> euclidean_vector {
-		// return 0 dimensions with 0 magnitude if vector has 0 dimensions
-		// (multiplied by anything = 0)
-		if (vector.dimensions() == 0) {
-			euclidean_vector retval(0, 0.0);
-			return retval;
-		}
-		auto vector_magnitudes = vector.magnitudes();
-		auto result_magnitudes = std::vector<double>();
-		for (auto i = 0; i < vector.dimensions(); i++) {
-			result_magnitudes.push_back(vector_magnitudes[static_cast<size_t>(i)] * multiplier);
-		}
-		euclidean_vector retval(result_magnitudes.begin(), result_magnitudes.end());
-		return retval;
-	}
-	// multiply (multiplier * vector) case
-	auto operator*(double multiplier, euclidean_vector const& vector) -> euclidean_vector {
-		// return 0 dimensions with 0 magnitude if vector has 0 dimensions
-		// (multiplied by anything = 0)
-		if (vector.dimensions() == 0) {
-			euclidean_vector retval(0, 0.0);
-			return retval;
-		}
-		auto vector_magnitudes = vector.magnitudes();
-		auto result_magnitudes = std::vector<double>();
-		for (auto i = 0; i < vector.dimensions(); i++) {
-			result_magnitudes.push_back(vector_magnitudes[static_cast<size_t>(i)] * multiplier);
-		}
-		euclidean_vector retval(result_magnitudes.begin(), result_magnitudes.end());
-		return retval;
-	}
-
-	// divide
-	auto operator/(euclidean_vector const& vector, double divisor) -> euclidean_vector {
-		// throw exception if divisor = 0
-		if (divisor == 0) {
-			throw euclidean_vector_error("Invalid vector division by 0");
+
+		template<typename Scalar>
+		auto norm_of(basic_euclidean_vector<Scalar> const& vector) -> Scalar {
+			if (vector.dimensions() == 0) {
+				return 0;
+			}
+			// if normal already found/cached, return it (safe with other threads doing the same)
+			auto& cache = detail::vector_access::norm(vector);
+			auto const cached = cache.load(std::memory_order_relaxed);
+			if (cached != detail::vector_access::norm_not_cached<Scalar>) {
+				return cached;
+			}
+			// if normal not found/cached, use formula to obtain euclidean normal (simd kernel for
+			// the sum of squares, on several threads for very long vectors)
+			auto const size = static_cast<size_t>(vector.dimensions());
+			auto euclidean_norm =
+			   std::sqrt(reduce_sum_of_squares(detail::vector_access::data(vector), size));
+			// cache the normal (prevent further calculations for given vector unless given vector is
+			// altered). threads racing here all store the same value.
+			cache.store(euclidean_norm, std::memory_order_relaxed);
+			return euclidean_norm;
+		}
+
+		template<typename Scalar>
+		auto unit_of(basic_euclidean_vector<Scalar> const& vector) -> basic_euclidean_vector<Scalar> {
+			// if no dimensions, throw exception
+			if (vector.dimensions() == 0) {
+				throw euclidean_vector_error("euclidean_vector with no dimensions does not have a unit "
+				                             "vector");
+			}
+			// if euclidean norm is 0, throw exception
+			auto normal = euclidean_norm(vector);
+			if (normal == 0) {
+				throw euclidean_vector_error("euclidean_vector with zero euclidean normal does not "
+				                             "have a unit vector");
+			}
+			// divide expression, evaluated straight into the result (a float normal is exact as a
+			// double, and the expression divides by it as a float again)
+			return vector / static_cast<double>(normal);
+		}
+
+		// unit vector of a temporary, divided in its own storage
+		template<typename Scalar>
+		auto unit_of(basic_euclidean_vector<Scalar>&& vector) -> basic_euclidean_vector<Scalar> {
+			// same exceptions as for a const vector
+			if (vector.dimensions() == 0) {
+				throw euclidean_vector_error("euclidean_vector with no dimensions does not have a unit "
+				                             "vector");
+			}
+			auto normal = euclidean_norm(vector);
+			if (normal == 0) {
+				throw euclidean_vector_error("euclidean_vector with zero euclidean normal does not "
+				                             "have a unit vector");
+			}
+			vector /= normal;
+			return std::move(vector);
+		}
+	} // namespace
+
+	auto euclidean_norm(euclidean_vector const& vector) -> double {
+		return norm_of(vector);
+	}
+
+	auto euclidean_norm(basic_euclidean_vector<float> const& vector) -> float {
+		return norm_of(vector);
+	}
+
+	auto unit(euclidean_vector const& vector) -> euclidean_vector {
+		return unit_of(vector);
+	}
+
+	auto unit(basic_euclidean_vector<float> const& vector) -> basic_euclidean_vector<float> {
+		return unit_of(vector);
+	}
+
+	auto unit(euclidean_vector&& vector) -> euclidean_vector {
+		return unit_of(std::move(vector));
+	}
+
+	auto unit(basic_euclidean_vector<float>&& vector) -> basic_euclidean_vector<float> {
+		return unit_of(std::move(vector));
+	}
+
+	// the same as for views of the two vectors
+	auto dot(euclidean_vector const& first, euclidean_vector const& second) -> double {
+		return dot(euclidean_vector_view(first), euclidean_vector_view(second));
+	}
+
+	auto dot(basic_euclidean_vector<float> const& first, basic_euclidean_vector<float> const& second)
+	   -> float {
+		return dot(euclidean_vector_view(first), euclidean_vector_view(second));
+	}
+
+	auto extended_dot(euclidean_vector const& first, euclidean_vector const& second) -> double {
+		return extended_dot(euclidean_vector_view(first), euclidean_vector_view(second));
+	}
+
+	auto extended_dot(basic_euclidean_vector<float> const& first,
+	                  basic_euclidean_vector<float> const& second) -> double {
+		return extended_dot(euclidean_vector_view(first), euclidean_vector_view(second));
+	}
+
+	// doubles already add up in double, so this can use the cached norm
+	auto extended_euclidean_norm(euclidean_vector const& vector) -> double {
+		return euclidean_norm(vector);
+	}
+
+	// (not cached, since the cache holds the float norm)
+	auto extended_euclidean_norm(basic_euclidean_vector<float> const& vector) -> double {
+		return extended_euclidean_norm(euclidean_vector_view(vector));
+	}
+
+	////// VIEWS ///////
+	namespace {
+		// a view has no norm to cache, so this is euclidean_norm without the caching
+		template<typename Scalar>
+		auto norm_of(euclidean_vector_view<Scalar const> vector) -> Scalar {
+			if (vector.dimensions() == 0) {
+				return 0;
+			}
+			auto const size = static_cast<size_t>(vector.dimensions());
+			return std::sqrt(reduce_sum_of_squares(vector.data(), size));
 		}
-		// return 0 dimensions with 0 magnitude if vector has 0 dimensions
-		// (divided by anything = 0)
-		if (vector.dimensions() == 0) {
-			euclidean_vector retval(0, 0.0);
-			return retval;
+
+		template<typename Scalar>
+		auto unit_of(euclidean_vector_view<Scalar const> vector) -> basic_euclidean_vector<Scalar> {
+			if (vector.dimensions() == 0) {
+				throw euclidean_vector_error("euclidean_vector with no dimensions does not have a unit "
+				                             "vector");
+			}
+			auto normal = euclidean_norm(vector);
+			if (normal == 0) {
+				throw euclidean_vector_error("euclidean_vector with zero euclidean normal does not "
+				                             "have a unit vector");
+			}
+			return vector / static_cast<double>(normal);
 		}
-		// carry out divide operation
-		auto vector_magnitudes = vector.magnitudes();
-		auto result_magnitudes = std::vector<double>();
-		for (auto i = 0; i < vector.dimensions(); i++) {
-			result_magnitudes.push_back(vector_magnitudes[static_cast<size_t>(i)] / divisor);
+
+		template<typename Scalar>
+		auto dot_of(euclidean_vector_view<Scalar const> first,
+		            euclidean_vector_view<Scalar const> second) -> Scalar {
+			// dimensions dont match, throw exception
+			if (first.dimensions() != second.dimensions()) {
+				detail::throw_dimension_mismatch(first.dimensions(), second.dimensions());
+			}
+			// return 0 if both dimensions are equal and are equal to 0.
+			if (first.dimensions() == 0) {
+				return 0;
+			}
+			// multiply pairs with the same index and add them up (simd kernel)
+			return reduce_dot(first.data(), second.data(), static_cast<size_t>(first.dimensions()));
 		}
-		euclidean_vector retval(result_magnitudes.begin(), result_magnitudes.end());
-		return retval;
-	}
 
-	// output stream
-	auto operator<<(std::ostream& output, euclidean_vector const& vector) -> std::ostream& {
-		// follow given output format, [ at the start, magnitudes with space in between then ] at the
-		// end
-		auto vector_magnitudes = vector.magnitudes();
-		output << "[";
-		auto counter = 0;
-		for (auto magnitude : vector_magnitudes) {
-			if (counter != 0) {
-				output << " ";
+		// dot and norm with the kernels that add up in double
+		template<typename Scalar>
+		auto extended_dot_of(euclidean_vector_view<Scalar const> first,
+		                     euclidean_vector_view<Scalar const> second) -> double {
+			if (first.dimensions() != second.dimensions()) {
+				detail::throw_dimension_mismatch(first.dimensions(), second.dimensions());
+			}
+			if (first.dimensions() == 0) {
+				return 0;
 			}
-			output << magnitude;
-			counter++;
+			return reduce_extended_dot(first.data(),
+			                           second.data(),
+			                           static_cast<size_t>(first.dimensions()));
 		}
-		output << "]";
-		return output;
-	}
 
-	////// UTILITY FUNCTIONS ///////
-	auto euclidean_norm(euclidean_vector const& vector) -> double {
-		if (vector.dimensions() == 0) {
-			return 0;
+		template<typename Scalar>
+		auto extended_norm_of(euclidean_vector_view<Scalar const> vector) -> double {
+			if (vector.dimensions() == 0) {
+				return 0;
+			}
+			auto const size = static_cast<size_t>(vector.dimensions());
+			return std::sqrt(reduce_extended_sum_of_squares(vector.data(), size));
 		}
-		// if no need to find normal (normal already found/cached, return vector)
-		if (!vector.find_normal) {
-			return vector.normal;
+
+		// the parallel reductions at any size
+		template<typename Scalar>
+		auto parallel_dot_of(euclidean_vector_view<Scalar const> first,
+		                     euclidean_vector_view<Scalar const> second,
+		                     unsigned threads) -> Scalar {
+			if (first.dimensions() != second.dimensions()) {
+				detail::throw_dimension_mismatch(first.dimensions(), second.dimensions());
+			}
+			return parallel_dot(first.data(),
+			                    second.data(),
+			                    static_cast<size_t>(first.dimensions()),
+			                    threads);
+		}
+
+		template<typename Scalar>
+		auto parallel_norm_of(euclidean_vector_view<Scalar const> vector, unsigned threads)
+		   -> Scalar {
+			auto const size = static_cast<size_t>(vector.dimensions());
+			return std::sqrt(parallel_sum_of_squares(vector.data(), size, threads));
+		}
+
+		// same format as a euclidean_vector
+		template<typename Scalar>
+		auto print(std::ostream& output, euclidean_vector_view<Scalar const> vector)
+		   -> std::ostream& {
+			output << "[";
+			for (auto i = 0; i < vector.dimensions(); i++) {
+				if (i != 0) {
+					output << " ";
+				}
+				output << vector[i];
+			}
+			output << "]";
+			return output;
 		}
-		// if normal not found/cached, use formula to obtain euclidean normal
-		auto vector_magnitudes = vector.magnitudes();
-		auto euclidean_norm = 0.0;
-		for (auto magnitude : vector_magnitudes) {
-			euclidean_norm += (magnitude * magnitude);
+	} // namespace
+
+	auto euclidean_norm(euclidean_vector_view<double const> vector) -> double {
+		return norm_of(vector);
+	}
+
+	auto euclidean_norm(euclidean_vector_view<float const> vector) -> float {
+		return norm_of(vector);
+	}
+
+	auto unit(euclidean_vector_view<double const> vector) -> euclidean_vector {
+		return unit_of(vector);
+	}
+
+	auto unit(euclidean_vector_view<float const> vector) -> basic_euclidean_vector<float> {
+		return unit_of(vector);
+	}
+
+	auto dot(euclidean_vector_view<double const> first, euclidean_vector_view<double const> second)
+	   -> double {
+		return dot_of(first, second);
+	}
+
+	auto dot(euclidean_vector_view<float const> first, euclidean_vector_view<float const> second)
+	   -> float {
+		return dot_of(first, second);
+	}
+
+	auto extended_dot(euclidean_vector_view<double const> first,
+	                  euclidean_vector_view<double const> second) -> double {
+		return extended_dot_of(first, second);
+	}
+
+	auto extended_dot(euclidean_vector_view<float const> first,
+	                  euclidean_vector_view<float const> second) -> double {
+		return extended_dot_of(first, second);
+	}
+
+	auto extended_euclidean_norm(euclidean_vector_view<double const> vector) -> double {
+		return extended_norm_of(vector);
+	}
+
+	auto extended_euclidean_norm(euclidean_vector_view<float const> vector) -> double {
+		return extended_norm_of(vector);
+	}
+
+	auto parallel_dot(euclidean_vector_view<double const> first,
+	                  euclidean_vector_view<double const> second,
+	                  unsigned threads) -> double {
+		return parallel_dot_of(first, second, threads);
+	}
+
+	auto parallel_dot(euclidean_vector_view<float const> first,
+	                  euclidean_vector_view<float const> second,
+	                  unsigned threads) -> float {
+		return parallel_dot_of(first, second, threads);
+	}
+
+	auto parallel_euclidean_norm(euclidean_vector_view<double const> vector, unsigned threads)
+	   -> double {
+		return parallel_norm_of(vector, threads);
+	}
+
+	auto parallel_euclidean_norm(euclidean_vector_view<float const> vector, unsigned threads)
+	   -> float {
+		return parallel_norm_of(vector, threads);
+	}
+
+	auto operator==(euclidean_vector_view<double const> first,
+	                euclidean_vector_view<double const> second) -> bool {
+		return std::equal(first.begin(), first.end(), second.begin(), second.end());
+	}
+
+	auto operator==(euclidean_vector_view<float const> first,
+	                euclidean_vector_view<float const> second) -> bool {
+		return std::equal(first.begin(), first.end(), second.begin(), second.end());
+	}
+
+	auto operator!=(euclidean_vector_view<double const> first,
+	                euclidean_vector_view<double const> second) -> bool {
+		return !(first == second);
+	}
+
+	auto operator!=(euclidean_vector_view<float const> first,
+	                euclidean_vector_view<float const> second) -> bool {
+		return !(first == second);
+	}
+
+	auto operator<<(std::ostream& output, euclidean_vector_view<double const> vector)
+	   -> std::ostream& {
+		return print(output, vector);
+	}
+
+	auto operator<<(std::ostream& output, euclidean_vector_view<float const> vector)
+	   -> std::ostream& {
+		return print(output, vector);
+	}
+
+	template<typename Magnitude>
+	auto euclidean_vector_view<Magnitude>::at(int dimension) const -> Magnitude& {
+		if (dimension < 0 || dimension >= this->dimensions()) {
+			throw euclidean_vector_error("Index " + std::to_string(dimension)
+			                             + " is not valid for this euclidean_vector object");
 		}
-		euclidean_norm = sqrt(euclidean_norm);
-		// set find_normal to false and cache normal into norm
-		// (prevent further calculations for given vector unless given vector is altered)
-		vector.find_normal = false;
-		vector.normal = euclidean_norm;
-		return euclidean_norm;
+		return this->magnitudes_[static_cast<size_t>(dimension)];
 	}
 
-	auto unit(euclidean_vector const& vector) -> euclidean_vector {
-		// if no dimensions, throw exception
-		if (vector.dimensions() == 0) {
-			throw euclidean_vector_error("euclidean_vector with no dimensions does not have a unit "
-			                             "vector");
+	template<typename Magnitude>
+	auto euclidean_vector_view<Magnitude>::operator+=(euclidean_vector_view<value_type const> view)
+	   -> euclidean_vector_view& requires(not std::is_const_v<Magnitude>) {
+		if (this->dimensions() != view.dimensions()) {
+			detail::throw_dimension_mismatch(this->dimensions(), view.dimensions());
 		}
-		// if euclidean norm is 0, throw exception
-		auto normal = euclidean_norm(vector);
-		if (normal == 0) {
-			throw euclidean_vector_error("euclidean_vector with zero euclidean normal does not have a "
-			                             "unit vector");
+		kernels<value_type>().add(this->magnitudes_,
+		                          view.data(),
+		                          static_cast<size_t>(this->dimensions()));
+		return *this;
+	}
+
+	template<typename Magnitude>
+	auto euclidean_vector_view<Magnitude>::operator-=(euclidean_vector_view<value_type const> view)
+	   -> euclidean_vector_view& requires(not std::is_const_v<Magnitude>) {
+		if (this->dimensions() != view.dimensions()) {
+			detail::throw_dimension_mismatch(this->dimensions(), view.dimensions());
 		}
-		// maybe I could just use divide operator on vector/normal (? TODO)
-		auto vector_magnitudes = vector.magnitudes();
-		auto result_magnitudes = std::vector<double>();
-		for (auto i = 0; i < vector.dimensions(); i++) {
-			result_magnitudes.push_back(vector_magnitudes[static_cast<size_t>(i)] / normal);
+		kernels<value_type>().subtract(this->magnitudes_,
+		                               view.data(),
+		                               static_cast<size_t>(this->dimensions()));
+		return *this;
+	}
+
+	template<typename Magnitude>
+	auto euclidean_vector_view<Magnitude>::operator*=(value_type multiplier)
+	   -> euclidean_vector_view& requires(not std::is_const_v<Magnitude>) {
+		kernels<value_type>().multiply(this->magnitudes_,
+		                               multiplier,
+		                               static_cast<size_t>(this->dimensions()));
+		return *this;
+	}
+
+	template<typename Magnitude>
+	auto euclidean_vector_view<Magnitude>::operator/=(value_type divisor)
+	   -> euclidean_vector_view& requires(not std::is_const_v<Magnitude>) {
+		if (divisor == 0) {
+			throw euclidean_vector_error("Invalid vector division by 0");
 		}
-		euclidean_vector retval(result_magnitudes.begin(), result_magnitudes.end());
-		return retval;
+		kernels<value_type>().divide(this->magnitudes_,
+		                             divisor,
+		                             static_cast<size_t>(this->dimensions()));
+		return *this;
 	}
 
-	auto dot(euclidean_vector const& first, euclidean_vector const& second) -> double {
-		// dimensions dont match, throw exception
-		if (first.dimensions() != second.dimensions()) {
-			throw euclidean_vector_error("Dimensions of LHS(" + std::to_string(first.dimensions())
-			                             + ") and RHS(" + std::to_string(second.dimensions())
-			                             + ") do not match");
+	template class euclidean_vector_view<double>;
+	template class euclidean_vector_view<double const>;
+	template class euclidean_vector_view<float>;
+	template class euclidean_vector_view<float const>;
+
+	/////// HELPER FUNCTIONS //////
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::allocate(int num_dimensions) -> void {
+		// a negative count would otherwise pass as inline and wrap once used as a size_t
+		if (num_dimensions < 0) {
+			throw euclidean_vector_error("Invalid vector dimensions "
+			                             + std::to_string(num_dimensions));
+		}
+		if (num_dimensions <= inline_capacity) {
+			this->heap_magnitudes_.reset();
+			this->magnitudes_ = this->inline_magnitudes_.data();
+		}
+		else {
+			// NOLINTNEXTLINE(modernize-avoid-c-arrays)
+			this->heap_magnitudes_.reset(new Scalar[static_cast<size_t>(num_dimensions)]);
+			this->magnitudes_ = this->heap_magnitudes_.get();
 		}
-		// return 0 if both dimensions are equal and are equal to 0.
-		if (first.dimensions() == 0) {
-			return 0;
+		this->num_dimensions_ = num_dimensions;
+	}
+
+	// a moved-from vector has no dimensions and points at its (empty) inline storage
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::take(basic_euclidean_vector& other) noexcept -> void {
+		if (other.heap_magnitudes_ != nullptr) {
+			this->heap_magnitudes_ = std::move(other.heap_magnitudes_);
+			this->magnitudes_ = this->heap_magnitudes_.get();
 		}
-		auto first_magnitudes = first.magnitudes();
-		auto second_magnitudes = second.magnitudes();
-		auto result = 0.0;
-		// loop through first and second's magnitudes and multiply both values, then add into result
-		for (auto i = 0; i < first.dimensions(); i++) {
-			result +=
-			   (first_magnitudes[static_cast<size_t>(i)] * second_magnitudes[static_cast<size_t>(i)]);
+		else {
+			this->heap_magnitudes_.reset();
+			this->magnitudes_ = this->inline_magnitudes_.data();
+			std::copy_n(other.magnitudes_, other.num_dimensions_, this->magnitudes_);
 		}
-		return result;
+		this->num_dimensions_ = std::exchange(other.num_dimensions_, 0);
+		other.magnitudes_ = other.inline_magnitudes_.data();
 	}
 
-	/////// HELPER FUNCTIONS //////
 	// getter for magnitudes (const and non const since there are const and non const functions that
 	// call it)
-	auto euclidean_vector::magnitudes() const -> std::vector<double> {
-		auto result_magnitudes = std::vector<double>();
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::magnitudes() const -> std::vector<Scalar> {
+		auto result_magnitudes = std::vector<Scalar>();
 		result_magnitudes.reserve(static_cast<size_t>(this->dimensions()));
 		for (auto i = 0; i < this->dimensions(); i++) {
 			auto magnitude = this->magnitudes_[static_cast<size_t>(i)];
@@ -533,8 +881,9 @@ namespace comp6771 {
 		}
 		return result_magnitudes;
 	}
-	auto euclidean_vector::magnitudes() -> std::vector<double> {
-		auto result_magnitudes = std::vector<double>();
+	template<typename Scalar>
+	auto basic_euclidean_vector<Scalar>::magnitudes() -> std::vector<Scalar> {
+		auto result_magnitudes = std::vector<Scalar>();
 		result_magnitudes.reserve(static_cast<size_t>(this->dimensions()));
 		for (auto i = 0; i < this->dimensions(); i++) {
 			auto magnitude = this->magnitudes_[static_cast<size_t>(i)];
@@ -542,4 +891,7 @@ namespace comp6771 {
 		}
 		return result_magnitudes;
 	}
+
+	template class basic_euclidean_vector<double>;
+	template class basic_euclidean_vector<float>;
 } // namespace comp6771
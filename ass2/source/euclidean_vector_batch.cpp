@@ -0,0 +1,255 @@
+#include <comp6771/euclidean_vector_batch.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <comp6771/parallel_reduction.hpp>
+#include <comp6771/vector_kernels.hpp>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace comp6771 {
+	namespace {
+		constexpr auto row_doubles = euclidean_vector_batch::row_alignment / sizeof(double);
+
+		auto padded(int dimensions) -> std::size_t {
+			auto const size = static_cast<std::size_t>(dimensions);
+			return (size + row_doubles - 1) / row_doubles * row_doubles;
+		}
+
+		// dimensions, sizes and capacities are ints, like a euclidean_vector's dimensions, but a
+		// negative one would wrap once it is used as a std::size_t
+		auto non_negative(int count, char const* what) -> int {
+			if (count < 0) {
+				throw euclidean_vector_error("Invalid batch " + std::string(what) + " "
+				                             + std::to_string(count));
+			}
+			return count;
+		}
+
+		auto check_results(std::span<double> results, int size) -> void {
+			if (results.size() < static_cast<std::size_t>(size)) {
+				throw euclidean_vector_error("Results of size " + std::to_string(results.size())
+				                             + " cannot hold " + std::to_string(size) + " rows");
+			}
+		}
+
+		// the reductions dot and euclidean_norm use for a vector of this many dimensions, so that a
+		// row gives the same bits as the vector: the serial kernels, or across threads from
+		// parallel_reduction_threshold dimensions on
+		auto row_dot(double const* first, double const* second, std::size_t dimensions) -> double {
+			if (dimensions >= parallel_reduction_threshold) {
+				return parallel_dot(first, second, dimensions);
+			}
+			return kernels().dot(first, second, dimensions);
+		}
+
+		auto row_norm(double const* row, std::size_t dimensions) -> double {
+			if (dimensions >= parallel_reduction_threshold) {
+				return std::sqrt(parallel_sum_of_squares(row, dimensions));
+			}
+			return std::sqrt(kernels().sum_of_squares(row, dimensions));
+		}
+	} // namespace
+
+	euclidean_vector_batch::euclidean_vector_batch(int dimensions, int size)
+	: dimensions_(non_negative(dimensions, "dimensions"))
+	, size_(non_negative(size, "size"))
+	, capacity_(size)
+	, stride_(padded(dimensions))
+	, magnitudes_(allocate(size)) {}
+
+	euclidean_vector_batch::euclidean_vector_batch(euclidean_vector_batch const& other)
+	: dimensions_(other.dimensions_)
+	, size_(other.size_)
+	, capacity_(other.size_)
+	, stride_(other.stride_)
+	, magnitudes_(allocate(other.size_)) {
+		std::copy_n(other.magnitudes_.get(), static_cast<std::size_t>(size_) * stride_, row(0));
+	}
+
+	// the moved-from batch keeps its dimensions but has no rows
+	euclidean_vector_batch::euclidean_vector_batch(euclidean_vector_batch&& other) noexcept
+	: dimensions_(other.dimensions_)
+	, size_(std::exchange(other.size_, 0))
+	, capacity_(std::exchange(other.capacity_, 0))
+	, stride_(other.stride_)
+	, magnitudes_(std::move(other.magnitudes_)) {}
+
+	auto euclidean_vector_batch::operator=(euclidean_vector_batch const& other)
+	   -> euclidean_vector_batch& {
+		if (this != &other) {
+			*this = euclidean_vector_batch(other);
+		}
+		return *this;
+	}
+
+	auto euclidean_vector_batch::operator=(euclidean_vector_batch&& other) noexcept
+	   -> euclidean_vector_batch& {
+		dimensions_ = other.dimensions_;
+		size_ = std::exchange(other.size_, 0);
+		capacity_ = std::exchange(other.capacity_, 0);
+		stride_ = other.stride_;
+		magnitudes_ = std::move(other.magnitudes_);
+		return *this;
+	}
+
+	auto euclidean_vector_batch::operator[](int row) -> euclidean_vector_view<double> {
+		assert(row >= 0 && row < size_);
+		return euclidean_vector_view<double>(this->row(row), dimensions_);
+	}
+
+	auto euclidean_vector_batch::operator[](int row) const -> euclidean_vector_view<double const> {
+		assert(row >= 0 && row < size_);
+		return euclidean_vector_view<double const>(this->row(row), dimensions_);
+	}
+
+	auto euclidean_vector_batch::at(int row) -> euclidean_vector_view<double> {
+		if (row < 0 || row >= size_) {
+			throw euclidean_vector_error("Index " + std::to_string(row)
+			                             + " is not valid for this euclidean_vector_batch object");
+		}
+		return (*this)[row];
+	}
+
+	auto euclidean_vector_batch::at(int row) const -> euclidean_vector_view<double const> {
+		if (row < 0 || row >= size_) {
+			throw euclidean_vector_error("Index " + std::to_string(row)
+			                             + " is not valid for this euclidean_vector_batch object");
+		}
+		return (*this)[row];
+	}
+
+	auto euclidean_vector_batch::push_back(euclidean_vector_view<double const> vector) -> void {
+		if (vector.dimensions() != dimensions_) {
+			detail::throw_dimension_mismatch(dimensions_, vector.dimensions());
+		}
+		if (size_ == capacity_) {
+			// the vector may be one of the rows, so it is copied before the old buffer goes
+			auto const capacity = std::max(1, capacity_ * 2);
+			auto grown = allocate(capacity);
+			auto const used = static_cast<std::size_t>(size_) * stride_;
+			std::copy_n(magnitudes_.get(), used, grown.get());
+			std::copy_n(vector.data(), dimensions_, grown.get() + used);
+			magnitudes_ = std::move(grown);
+			capacity_ = capacity;
+		}
+		else {
+			std::copy_n(vector.data(), dimensions_, row(size_));
+		}
+		++size_;
+	}
+
+	auto euclidean_vector_batch::reserve(int capacity) -> void {
+		if (non_negative(capacity, "capacity") <= capacity_) {
+			return;
+		}
+		auto grown = allocate(capacity);
+		std::copy_n(magnitudes_.get(), static_cast<std::size_t>(size_) * stride_, grown.get());
+		magnitudes_ = std::move(grown);
+		capacity_ = capacity;
+	}
+
+	auto euclidean_vector_batch::operator*=(double multiplier) -> euclidean_vector_batch& {
+		// row by row rather than over the whole buffer, so the padding stays 0 whatever the
+		// multiplier (0 * infinity is not 0)
+		for (auto i = 0; i < size_; i++) {
+			kernels().multiply(row(i), multiplier, static_cast<std::size_t>(dimensions_));
+		}
+		return *this;
+	}
+
+	auto euclidean_vector_batch::operator/=(double divisor) -> euclidean_vector_batch& {
+		if (divisor == 0.0) {
+			throw euclidean_vector_error("Invalid vector division by 0");
+		}
+		for (auto i = 0; i < size_; i++) {
+			kernels().divide(row(i), divisor, static_cast<std::size_t>(dimensions_));
+		}
+		return *this;
+	}
+
+	auto euclidean_vector_batch::size() const noexcept -> int {
+		return size_;
+	}
+
+	auto euclidean_vector_batch::dimensions() const noexcept -> int {
+		return dimensions_;
+	}
+
+	auto euclidean_vector_batch::stride() const noexcept -> std::size_t {
+		return stride_;
+	}
+
+	auto euclidean_vector_batch::allocate(int capacity) const -> buffer {
+		auto const doubles = static_cast<std::size_t>(capacity) * stride_;
+		if (doubles == 0) {
+			return buffer();
+		}
+		auto* memory = static_cast<double*>(
+		   ::operator new[](doubles * sizeof(double), std::align_val_t{row_alignment}));
+		std::fill_n(memory, doubles, 0.0);
+		return buffer(memory);
+	}
+
+	auto euclidean_vector_batch::row(int index) const noexcept -> double* {
+		return magnitudes_.get() + static_cast<std::size_t>(index) * stride_;
+	}
+
+	/////// BATCHED OPERATIONS ///////
+	auto dot(euclidean_vector_batch const& batch,
+	         euclidean_vector_view<double const> query,
+	         std::span<double> results) -> void {
+		if (batch.dimensions() != query.dimensions()) {
+			detail::throw_dimension_mismatch(batch.dimensions(), query.dimensions());
+		}
+		check_results(results, batch.size());
+		auto const dimensions = static_cast<std::size_t>(batch.dimensions());
+		for (auto i = 0; i < batch.size(); i++) {
+			results[static_cast<std::size_t>(i)] = row_dot(batch[i].data(), query.data(), dimensions);
+		}
+	}
+
+	auto dot(euclidean_vector_batch const& first,
+	         euclidean_vector_batch const& second,
+	         std::span<double> results) -> void {
+		if (first.dimensions() != second.dimensions()) {
+			detail::throw_dimension_mismatch(first.dimensions(), second.dimensions());
+		}
+		if (first.size() != second.size()) {
+			throw euclidean_vector_error("Sizes of LHS(" + std::to_string(first.size()) + ") and RHS("
+			                             + std::to_string(second.size()) + ") do not match");
+		}
+		check_results(results, first.size());
+		auto const dimensions = static_cast<std::size_t>(first.dimensions());
+		for (auto i = 0; i < first.size(); i++) {
+			results[static_cast<std::size_t>(i)] =
+			   row_dot(first[i].data(), second[i].data(), dimensions);
+		}
+	}
+
+	auto euclidean_norms(euclidean_vector_batch const& batch, std::span<double> results) -> void {
+		check_results(results, batch.size());
+		auto const dimensions = static_cast<std::size_t>(batch.dimensions());
+		for (auto i = 0; i < batch.size(); i++) {
+			results[static_cast<std::size_t>(i)] = row_norm(batch[i].data(), dimensions);
+		}
+	}
+
+	// the norm and the division are done a row at a time, so the row is still in cache for the
+	// second pass over it
+	auto normalize(euclidean_vector_batch& batch) -> void {
+		auto const& kernel = kernels();
+		auto const dimensions = static_cast<std::size_t>(batch.dimensions());
+		for (auto i = 0; i < batch.size(); i++) {
+			auto* row = batch[i].data();
+			auto const normal = row_norm(row, dimensions);
+			if (normal != 0) {
+				kernel.divide(row, normal, dimensions);
+			}
+		}
+	}
+} // namespace comp6771
@@ -0,0 +1,109 @@
+#include <comp6771/parallel_reduction.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <comp6771/vector_kernels.hpp>
+#include <thread>
+#include <vector>
+
+namespace comp6771 {
+	namespace {
+		// blocks a thread takes at a time, so that the threads are not all after the counter
+		constexpr auto blocks_per_task = std::size_t{64};
+
+		// reduce(begin, size) gives the sum of one block. the block sums are kept (one Sum per
+		// reduction_block elements) and combined once every thread is done.
+		template<typename Sum, typename Reduce>
+		auto reduce_blocks(std::size_t size, unsigned threads, Reduce reduce) -> Sum {
+			if (size == 0) {
+				return 0;
+			}
+			auto const blocks = (size + reduction_block - 1) / reduction_block;
+			auto const tasks = (blocks + blocks_per_task - 1) / blocks_per_task;
+			auto sums = std::vector<Sum>(blocks);
+			auto next = std::atomic<std::size_t>{0};
+			auto const worker = [&] {
+				for (auto task = next.fetch_add(1); task < tasks; task = next.fetch_add(1)) {
+					auto const last = std::min(blocks, (task + 1) * blocks_per_task);
+					for (auto block = task * blocks_per_task; block < last; ++block) {
+						auto const begin = block * reduction_block;
+						sums[block] = reduce(begin, std::min(reduction_block, size - begin));
+					}
+				}
+			};
+			if (threads == 0) {
+				threads = std::max(1U, std::thread::hardware_concurrency());
+			}
+			{
+				auto pool = std::vector<std::jthread>();
+				for (auto i = 1U; i < std::min<std::size_t>(threads, tasks); ++i) {
+					pool.emplace_back(worker);
+				}
+				worker();
+			}
+
+			// neighbouring sums added pairwise until one is left (an odd one out moves up as is)
+			for (auto count = blocks; count > 1; count = (count + 1) / 2) {
+				for (auto i = std::size_t{0}; i < count / 2; ++i) {
+					sums[i] = sums[2 * i] + sums[2 * i + 1];
+				}
+				if (count % 2 == 1) {
+					sums[count / 2] = sums[count - 1];
+				}
+			}
+			return sums.front();
+		}
+	} // namespace
+
+	template<typename Scalar>
+	auto parallel_dot(Scalar const* first, Scalar const* second, std::size_t size, unsigned threads)
+	   -> Scalar {
+		auto const& kernel = kernels<Scalar>();
+		return reduce_blocks<Scalar>(size, threads, [&](std::size_t begin, std::size_t length) {
+			return kernel.dot(first + begin, second + begin, length);
+		});
+	}
+
+	template<typename Scalar>
+	auto parallel_sum_of_squares(Scalar const* values, std::size_t size, unsigned threads)
+	   -> Scalar {
+		auto const& kernel = kernels<Scalar>();
+		return reduce_blocks<Scalar>(size, threads, [&](std::size_t begin, std::size_t length) {
+			return kernel.sum_of_squares(values + begin, length);
+		});
+	}
+
+	template<typename Scalar>
+	auto parallel_extended_dot(Scalar const* first,
+	                           Scalar const* second,
+	                           std::size_t size,
+	                           unsigned threads) -> double {
+		auto const& kernel = kernels<Scalar>();
+		return reduce_blocks<double>(size, threads, [&](std::size_t begin, std::size_t length) {
+			return kernel.extended_dot(first + begin, second + begin, length);
+		});
+	}
+
+	template<typename Scalar>
+	auto parallel_extended_sum_of_squares(Scalar const* values, std::size_t size, unsigned threads)
+	   -> double {
+		auto const& kernel = kernels<Scalar>();
+		return reduce_blocks<double>(size, threads, [&](std::size_t begin, std::size_t length) {
+			return kernel.extended_sum_of_squares(values + begin, length);
+		});
+	}
+
+	template auto parallel_dot<double>(double const*, double const*, std::size_t, unsigned)
+	   -> double;
+	template auto parallel_dot<float>(float const*, float const*, std::size_t, unsigned) -> float;
+	template auto parallel_sum_of_squares<double>(double const*, std::size_t, unsigned) -> double;
+	template auto parallel_sum_of_squares<float>(float const*, std::size_t, unsigned) -> float;
+	template auto parallel_extended_dot<double>(double const*, double const*, std::size_t, unsigned)
+	   -> double;
+	template auto parallel_extended_dot<float>(float const*, float const*, std::size_t, unsigned)
+	   -> double;
+	template auto parallel_extended_sum_of_squares<double>(double const*, std::size_t, unsigned)
+	   -> double;
+	template auto parallel_extended_sum_of_squares<float>(float const*, std::size_t, unsigned)
+	   -> double;
+} // namespace comp6771
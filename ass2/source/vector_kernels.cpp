@@ -0,0 +1,766 @@
+#include <comp6771/vector_kernels.hpp>
+
+#include <array>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define COMP6771_VECTOR_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace comp6771 {
+	namespace {
+		// element i of a reduction goes to partial sum i % lanes: as many as fit in 512 bits
+		template<typename Scalar>
+		constexpr auto lanes = std::size_t{64 / sizeof(Scalar)};
+		template<typename Scalar>
+		using partial_sums = std::array<Scalar, lanes<Scalar>>;
+
+		// neighbouring sums added pairwise until one is left
+		template<typename Scalar, std::size_t Size>
+		auto combine(std::array<Scalar, Size> sums) -> Scalar {
+			for (auto size = Size; size > 1; size /= 2) {
+				for (auto i = std::size_t{0}; i < size / 2; ++i) {
+					sums[i] = sums[2 * i] + sums[2 * i + 1];
+				}
+			}
+			return sums[0];
+		}
+
+		// adds the elements after the last full group of lanes (from begin on) and combines the sums
+		template<typename Scalar>
+		auto finish_dot(partial_sums<Scalar>& sums,
+		                Scalar const* first,
+		                Scalar const* second,
+		                std::size_t begin,
+		                std::size_t size) -> Scalar {
+			for (auto i = begin; i < size; ++i) {
+				sums[i - begin] += first[i] * second[i];
+			}
+			return combine(sums);
+		}
+
+		// the same for the float kernels that accumulate in double
+		auto finish_extended_dot(partial_sums<double>& sums,
+		                         float const* first,
+		                         float const* second,
+		                         std::size_t begin,
+		                         std::size_t size) -> double {
+			for (auto i = begin; i < size; ++i) {
+				sums[i - begin] += static_cast<double>(first[i]) * static_cast<double>(second[i]);
+			}
+			return combine(sums);
+		}
+
+		// the kernels of one level for the given scalar type
+		template<typename Scalar>
+		auto pick(vector_kernels const& double_kernels,
+		          basic_vector_kernels<float> const& float_kernels)
+		   -> basic_vector_kernels<Scalar> const& {
+			if constexpr (std::is_same_v<Scalar, float>) {
+				return float_kernels;
+			}
+			else {
+				return double_kernels;
+			}
+		}
+
+		/////// SCALAR ///////
+		template<typename Scalar>
+		auto dot_scalar(Scalar const* first, Scalar const* second, std::size_t size) -> Scalar {
+			auto sums = partial_sums<Scalar>{};
+			auto i = std::size_t{0};
+			for (; i + lanes<Scalar> <= size; i += lanes<Scalar>) {
+				for (auto lane = std::size_t{0}; lane < lanes<Scalar>; ++lane) {
+					sums[lane] += first[i + lane] * second[i + lane];
+				}
+			}
+			return finish_dot(sums, first, second, i, size);
+		}
+
+		template<typename Scalar>
+		auto sum_of_squares_scalar(Scalar const* values, std::size_t size) -> Scalar {
+			return dot_scalar(values, values, size);
+		}
+
+		auto extended_dot_scalar(float const* first, float const* second, std::size_t size)
+		   -> double {
+			auto sums = partial_sums<double>{};
+			auto i = std::size_t{0};
+			for (; i + lanes<double> <= size; i += lanes<double>) {
+				for (auto lane = std::size_t{0}; lane < lanes<double>; ++lane) {
+					sums[lane] +=
+					   static_cast<double>(first[i + lane]) * static_cast<double>(second[i + lane]);
+				}
+			}
+			return finish_extended_dot(sums, first, second, i, size);
+		}
+
+		auto extended_sum_of_squares_scalar(float const* values, std::size_t size) -> double {
+			return extended_dot_scalar(values, values, size);
+		}
+
+		template<typename Scalar>
+		auto add_scalar(Scalar* values, Scalar const* others, std::size_t size) -> void {
+			for (auto i = std::size_t{0}; i < size; ++i) {
+				values[i] += others[i];
+			}
+		}
+
+		template<typename Scalar>
+		auto subtract_scalar(Scalar* values, Scalar const* others, std::size_t size) -> void {
+			for (auto i = std::size_t{0}; i < size; ++i) {
+				values[i] -= others[i];
+			}
+		}
+
+		template<typename Scalar>
+		auto multiply_scalar(Scalar* values, Scalar multiplier, std::size_t size) -> void {
+			for (auto i = std::size_t{0}; i < size; ++i) {
+				values[i] *= multiplier;
+			}
+		}
+
+		template<typename Scalar>
+		auto divide_scalar(Scalar* values, Scalar divisor, std::size_t size) -> void {
+			for (auto i = std::size_t{0}; i < size; ++i) {
+				values[i] /= divisor;
+			}
+		}
+
+		constexpr auto scalar_kernels = vector_kernels{
+		   dot_scalar<double>,
+		   sum_of_squares_scalar<double>,
+		   add_scalar<double>,
+		   subtract_scalar<double>,
+		   multiply_scalar<double>,
+		   divide_scalar<double>,
+		   dot_scalar<double>,
+		   sum_of_squares_scalar<double>,
+		};
+
+		constexpr auto scalar_float_kernels = basic_vector_kernels<float>{
+		   dot_scalar<float>,
+		   sum_of_squares_scalar<float>,
+		   add_scalar<float>,
+		   subtract_scalar<float>,
+		   multiply_scalar<float>,
+		   divide_scalar<float>,
+		   extended_dot_scalar,
+		   extended_sum_of_squares_scalar,
+		};
+
+#ifdef COMP6771_VECTOR_KERNELS_X86
+		/////// SSE2 (four registers of two doubles or four floats) ///////
+		[[gnu::target("sse2")]] auto
+		dot_sse2(double const* first, double const* second, std::size_t size) -> double {
+			auto sums_01 = _mm_setzero_pd();
+			auto sums_23 = _mm_setzero_pd();
+			auto sums_45 = _mm_setzero_pd();
+			auto sums_67 = _mm_setzero_pd();
+			auto const product = [&](std::size_t at) {
+				return _mm_mul_pd(_mm_loadu_pd(first + at), _mm_loadu_pd(second + at));
+			};
+			auto i = std::size_t{0};
+			for (; i + lanes<double> <= size; i += lanes<double>) {
+				sums_01 = _mm_add_pd(sums_01, product(i));
+				sums_23 = _mm_add_pd(sums_23, product(i + 2));
+				sums_45 = _mm_add_pd(sums_45, product(i + 4));
+				sums_67 = _mm_add_pd(sums_67, product(i + 6));
+			}
+			auto lane_sums = partial_sums<double>{};
+			_mm_storeu_pd(lane_sums.data(), sums_01);
+			_mm_storeu_pd(lane_sums.data() + 2, sums_23);
+			_mm_storeu_pd(lane_sums.data() + 4, sums_45);
+			_mm_storeu_pd(lane_sums.data() + 6, sums_67);
+			return finish_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("sse2")]] auto sum_of_squares_sse2(double const* values, std::size_t size)
+		   -> double {
+			return dot_sse2(values, values, size);
+		}
+
+		[[gnu::target("sse2")]] auto add_sse2(double* values, double const* others, std::size_t size)
+		   -> void {
+			auto i = std::size_t{0};
+			for (; i + 2 <= size; i += 2) {
+				auto const sum = _mm_add_pd(_mm_loadu_pd(values + i), _mm_loadu_pd(others + i));
+				_mm_storeu_pd(values + i, sum);
+			}
+			add_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("sse2")]] auto
+		subtract_sse2(double* values, double const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 2 <= size; i += 2) {
+				auto const difference = _mm_sub_pd(_mm_loadu_pd(values + i), _mm_loadu_pd(others + i));
+				_mm_storeu_pd(values + i, difference);
+			}
+			subtract_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("sse2")]] auto
+		multiply_sse2(double* values, double multiplier, std::size_t size) -> void {
+			auto const factor = _mm_set1_pd(multiplier);
+			auto i = std::size_t{0};
+			for (; i + 2 <= size; i += 2) {
+				_mm_storeu_pd(values + i, _mm_mul_pd(_mm_loadu_pd(values + i), factor));
+			}
+			multiply_scalar(values + i, multiplier, size - i);
+		}
+
+		[[gnu::target("sse2")]] auto divide_sse2(double* values, double divisor, std::size_t size)
+		   -> void {
+			auto const denominator = _mm_set1_pd(divisor);
+			auto i = std::size_t{0};
+			for (; i + 2 <= size; i += 2) {
+				_mm_storeu_pd(values + i, _mm_div_pd(_mm_loadu_pd(values + i), denominator));
+			}
+			divide_scalar(values + i, divisor, size - i);
+		}
+
+		[[gnu::target("sse2")]] auto
+		dot_sse2(float const* first, float const* second, std::size_t size) -> float {
+			auto sums_0 = _mm_setzero_ps();
+			auto sums_4 = _mm_setzero_ps();
+			auto sums_8 = _mm_setzero_ps();
+			auto sums_12 = _mm_setzero_ps();
+			auto const product = [&](std::size_t at) {
+				return _mm_mul_ps(_mm_loadu_ps(first + at), _mm_loadu_ps(second + at));
+			};
+			auto i = std::size_t{0};
+			for (; i + lanes<float> <= size; i += lanes<float>) {
+				sums_0 = _mm_add_ps(sums_0, product(i));
+				sums_4 = _mm_add_ps(sums_4, product(i + 4));
+				sums_8 = _mm_add_ps(sums_8, product(i + 8));
+				sums_12 = _mm_add_ps(sums_12, product(i + 12));
+			}
+			auto lane_sums = partial_sums<float>{};
+			_mm_storeu_ps(lane_sums.data(), sums_0);
+			_mm_storeu_ps(lane_sums.data() + 4, sums_4);
+			_mm_storeu_ps(lane_sums.data() + 8, sums_8);
+			_mm_storeu_ps(lane_sums.data() + 12, sums_12);
+			return finish_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("sse2")]] auto sum_of_squares_sse2(float const* values, std::size_t size)
+		   -> float {
+			return dot_sse2(values, values, size);
+		}
+
+		// each register of four floats is widened into two of two doubles
+		[[gnu::target("sse2")]] auto
+		extended_dot_sse2(float const* first, float const* second, std::size_t size) -> double {
+			auto sums_01 = _mm_setzero_pd();
+			auto sums_23 = _mm_setzero_pd();
+			auto sums_45 = _mm_setzero_pd();
+			auto sums_67 = _mm_setzero_pd();
+			auto const product = [](__m128 first_i, __m128 second_i) {
+				return _mm_mul_pd(_mm_cvtps_pd(first_i), _mm_cvtps_pd(second_i));
+			};
+			auto const high = [](__m128 values) { return _mm_movehl_ps(values, values); };
+			auto i = std::size_t{0};
+			for (; i + lanes<double> <= size; i += lanes<double>) {
+				auto const first_0 = _mm_loadu_ps(first + i);
+				auto const first_4 = _mm_loadu_ps(first + i + 4);
+				auto const second_0 = _mm_loadu_ps(second + i);
+				auto const second_4 = _mm_loadu_ps(second + i + 4);
+				sums_01 = _mm_add_pd(sums_01, product(first_0, second_0));
+				sums_23 = _mm_add_pd(sums_23, product(high(first_0), high(second_0)));
+				sums_45 = _mm_add_pd(sums_45, product(first_4, second_4));
+				sums_67 = _mm_add_pd(sums_67, product(high(first_4), high(second_4)));
+			}
+			auto lane_sums = partial_sums<double>{};
+			_mm_storeu_pd(lane_sums.data(), sums_01);
+			_mm_storeu_pd(lane_sums.data() + 2, sums_23);
+			_mm_storeu_pd(lane_sums.data() + 4, sums_45);
+			_mm_storeu_pd(lane_sums.data() + 6, sums_67);
+			return finish_extended_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("sse2")]] auto
+		extended_sum_of_squares_sse2(float const* values, std::size_t size) -> double {
+			return extended_dot_sse2(values, values, size);
+		}
+
+		[[gnu::target("sse2")]] auto add_sse2(float* values, float const* others, std::size_t size)
+		   -> void {
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				auto const sum = _mm_add_ps(_mm_loadu_ps(values + i), _mm_loadu_ps(others + i));
+				_mm_storeu_ps(values + i, sum);
+			}
+			add_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("sse2")]] auto
+		subtract_sse2(float* values, float const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				auto const difference = _mm_sub_ps(_mm_loadu_ps(values + i), _mm_loadu_ps(others + i));
+				_mm_storeu_ps(values + i, difference);
+			}
+			subtract_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("sse2")]] auto
+		multiply_sse2(float* values, float multiplier, std::size_t size) -> void {
+			auto const factor = _mm_set1_ps(multiplier);
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				_mm_storeu_ps(values + i, _mm_mul_ps(_mm_loadu_ps(values + i), factor));
+			}
+			multiply_scalar(values + i, multiplier, size - i);
+		}
+
+		[[gnu::target("sse2")]] auto divide_sse2(float* values, float divisor, std::size_t size)
+		   -> void {
+			auto const denominator = _mm_set1_ps(divisor);
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				_mm_storeu_ps(values + i, _mm_div_ps(_mm_loadu_ps(values + i), denominator));
+			}
+			divide_scalar(values + i, divisor, size - i);
+		}
+
+		constexpr auto sse2_kernels = vector_kernels{
+		   dot_sse2,
+		   sum_of_squares_sse2,
+		   add_sse2,
+		   subtract_sse2,
+		   multiply_sse2,
+		   divide_sse2,
+		   dot_sse2,
+		   sum_of_squares_sse2,
+		};
+
+		constexpr auto sse2_float_kernels = basic_vector_kernels<float>{
+		   dot_sse2,
+		   sum_of_squares_sse2,
+		   add_sse2,
+		   subtract_sse2,
+		   multiply_sse2,
+		   divide_sse2,
+		   extended_dot_sse2,
+		   extended_sum_of_squares_sse2,
+		};
+
+		/////// AVX2 (two registers of four doubles or eight floats) ///////
+		[[gnu::target("avx2")]] auto
+		dot_avx2(double const* first, double const* second, std::size_t size) -> double {
+			auto low = _mm256_setzero_pd();
+			auto high = _mm256_setzero_pd();
+			auto i = std::size_t{0};
+			for (; i + lanes<double> <= size; i += lanes<double>) {
+				auto const first_low = _mm256_loadu_pd(first + i);
+				auto const first_high = _mm256_loadu_pd(first + i + 4);
+				low = _mm256_add_pd(low, _mm256_mul_pd(first_low, _mm256_loadu_pd(second + i)));
+				high = _mm256_add_pd(high, _mm256_mul_pd(first_high, _mm256_loadu_pd(second + i + 4)));
+			}
+			auto lane_sums = partial_sums<double>{};
+			_mm256_storeu_pd(lane_sums.data(), low);
+			_mm256_storeu_pd(lane_sums.data() + 4, high);
+			return finish_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("avx2")]] auto sum_of_squares_avx2(double const* values, std::size_t size)
+		   -> double {
+			return dot_avx2(values, values, size);
+		}
+
+		[[gnu::target("avx2")]] auto add_avx2(double* values, double const* others, std::size_t size)
+		   -> void {
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				auto const values_i = _mm256_loadu_pd(values + i);
+				auto const sum = _mm256_add_pd(values_i, _mm256_loadu_pd(others + i));
+				_mm256_storeu_pd(values + i, sum);
+			}
+			add_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx2")]] auto
+		subtract_avx2(double* values, double const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				auto const values_i = _mm256_loadu_pd(values + i);
+				auto const difference = _mm256_sub_pd(values_i, _mm256_loadu_pd(others + i));
+				_mm256_storeu_pd(values + i, difference);
+			}
+			subtract_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx2")]] auto
+		multiply_avx2(double* values, double multiplier, std::size_t size) -> void {
+			auto const factor = _mm256_set1_pd(multiplier);
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				_mm256_storeu_pd(values + i, _mm256_mul_pd(_mm256_loadu_pd(values + i), factor));
+			}
+			multiply_scalar(values + i, multiplier, size - i);
+		}
+
+		[[gnu::target("avx2")]] auto divide_avx2(double* values, double divisor, std::size_t size)
+		   -> void {
+			auto const denominator = _mm256_set1_pd(divisor);
+			auto i = std::size_t{0};
+			for (; i + 4 <= size; i += 4) {
+				_mm256_storeu_pd(values + i, _mm256_div_pd(_mm256_loadu_pd(values + i), denominator));
+			}
+			divide_scalar(values + i, divisor, size - i);
+		}
+
+		[[gnu::target("avx2")]] auto
+		dot_avx2(float const* first, float const* second, std::size_t size) -> float {
+			auto low = _mm256_setzero_ps();
+			auto high = _mm256_setzero_ps();
+			auto i = std::size_t{0};
+			for (; i + lanes<float> <= size; i += lanes<float>) {
+				auto const first_low = _mm256_loadu_ps(first + i);
+				auto const first_high = _mm256_loadu_ps(first + i + 8);
+				low = _mm256_add_ps(low, _mm256_mul_ps(first_low, _mm256_loadu_ps(second + i)));
+				high = _mm256_add_ps(high, _mm256_mul_ps(first_high, _mm256_loadu_ps(second + i + 8)));
+			}
+			auto lane_sums = partial_sums<float>{};
+			_mm256_storeu_ps(lane_sums.data(), low);
+			_mm256_storeu_ps(lane_sums.data() + 8, high);
+			return finish_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("avx2")]] auto sum_of_squares_avx2(float const* values, std::size_t size)
+		   -> float {
+			return dot_avx2(values, values, size);
+		}
+
+		// four floats at a time widened into one register of four doubles
+		[[gnu::target("avx2")]] auto
+		extended_dot_avx2(float const* first, float const* second, std::size_t size) -> double {
+			auto low = _mm256_setzero_pd();
+			auto high = _mm256_setzero_pd();
+			auto i = std::size_t{0};
+			for (; i + lanes<double> <= size; i += lanes<double>) {
+				auto const first_low = _mm256_cvtps_pd(_mm_loadu_ps(first + i));
+				auto const first_high = _mm256_cvtps_pd(_mm_loadu_ps(first + i + 4));
+				auto const second_low = _mm256_cvtps_pd(_mm_loadu_ps(second + i));
+				auto const second_high = _mm256_cvtps_pd(_mm_loadu_ps(second + i + 4));
+				low = _mm256_add_pd(low, _mm256_mul_pd(first_low, second_low));
+				high = _mm256_add_pd(high, _mm256_mul_pd(first_high, second_high));
+			}
+			auto lane_sums = partial_sums<double>{};
+			_mm256_storeu_pd(lane_sums.data(), low);
+			_mm256_storeu_pd(lane_sums.data() + 4, high);
+			return finish_extended_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("avx2")]] auto
+		extended_sum_of_squares_avx2(float const* values, std::size_t size) -> double {
+			return extended_dot_avx2(values, values, size);
+		}
+
+		[[gnu::target("avx2")]] auto add_avx2(float* values, float const* others, std::size_t size)
+		   -> void {
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				auto const values_i = _mm256_loadu_ps(values + i);
+				auto const sum = _mm256_add_ps(values_i, _mm256_loadu_ps(others + i));
+				_mm256_storeu_ps(values + i, sum);
+			}
+			add_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx2")]] auto
+		subtract_avx2(float* values, float const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				auto const values_i = _mm256_loadu_ps(values + i);
+				auto const difference = _mm256_sub_ps(values_i, _mm256_loadu_ps(others + i));
+				_mm256_storeu_ps(values + i, difference);
+			}
+			subtract_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx2")]] auto
+		multiply_avx2(float* values, float multiplier, std::size_t size) -> void {
+			auto const factor = _mm256_set1_ps(multiplier);
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				_mm256_storeu_ps(values + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), factor));
+			}
+			multiply_scalar(values + i, multiplier, size - i);
+		}
+
+		[[gnu::target("avx2")]] auto divide_avx2(float* values, float divisor, std::size_t size)
+		   -> void {
+			auto const denominator = _mm256_set1_ps(divisor);
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				_mm256_storeu_ps(values + i, _mm256_div_ps(_mm256_loadu_ps(values + i), denominator));
+			}
+			divide_scalar(values + i, divisor, size - i);
+		}
+
+		constexpr auto avx2_kernels = vector_kernels{
+		   dot_avx2,
+		   sum_of_squares_avx2,
+		   add_avx2,
+		   subtract_avx2,
+		   multiply_avx2,
+		   divide_avx2,
+		   dot_avx2,
+		   sum_of_squares_avx2,
+		};
+
+		constexpr auto avx2_float_kernels = basic_vector_kernels<float>{
+		   dot_avx2,
+		   sum_of_squares_avx2,
+		   add_avx2,
+		   subtract_avx2,
+		   multiply_avx2,
+		   divide_avx2,
+		   extended_dot_avx2,
+		   extended_sum_of_squares_avx2,
+		};
+
+		/////// AVX-512 (one register of eight doubles or sixteen floats) ///////
+		[[gnu::target("avx512f")]] auto
+		dot_avx512(double const* first, double const* second, std::size_t size) -> double {
+			auto sums = _mm512_setzero_pd();
+			auto i = std::size_t{0};
+			for (; i + lanes<double> <= size; i += lanes<double>) {
+				auto const first_i = _mm512_loadu_pd(first + i);
+				auto const product = _mm512_mul_pd(first_i, _mm512_loadu_pd(second + i));
+				sums = _mm512_add_pd(sums, product);
+			}
+			auto lane_sums = partial_sums<double>{};
+			_mm512_storeu_pd(lane_sums.data(), sums);
+			return finish_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("avx512f")]] auto sum_of_squares_avx512(double const* values, std::size_t size)
+		   -> double {
+			return dot_avx512(values, values, size);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		add_avx512(double* values, double const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				auto const values_i = _mm512_loadu_pd(values + i);
+				auto const sum = _mm512_add_pd(values_i, _mm512_loadu_pd(others + i));
+				_mm512_storeu_pd(values + i, sum);
+			}
+			add_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		subtract_avx512(double* values, double const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				auto const values_i = _mm512_loadu_pd(values + i);
+				auto const difference = _mm512_sub_pd(values_i, _mm512_loadu_pd(others + i));
+				_mm512_storeu_pd(values + i, difference);
+			}
+			subtract_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		multiply_avx512(double* values, double multiplier, std::size_t size) -> void {
+			auto const factor = _mm512_set1_pd(multiplier);
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				_mm512_storeu_pd(values + i, _mm512_mul_pd(_mm512_loadu_pd(values + i), factor));
+			}
+			multiply_scalar(values + i, multiplier, size - i);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		divide_avx512(double* values, double divisor, std::size_t size) -> void {
+			auto const denominator = _mm512_set1_pd(divisor);
+			auto i = std::size_t{0};
+			for (; i + 8 <= size; i += 8) {
+				_mm512_storeu_pd(values + i, _mm512_div_pd(_mm512_loadu_pd(values + i), denominator));
+			}
+			divide_scalar(values + i, divisor, size - i);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		dot_avx512(float const* first, float const* second, std::size_t size) -> float {
+			auto sums = _mm512_setzero_ps();
+			auto i = std::size_t{0};
+			for (; i + lanes<float> <= size; i += lanes<float>) {
+				auto const first_i = _mm512_loadu_ps(first + i);
+				auto const product = _mm512_mul_ps(first_i, _mm512_loadu_ps(second + i));
+				sums = _mm512_add_ps(sums, product);
+			}
+			auto lane_sums = partial_sums<float>{};
+			_mm512_storeu_ps(lane_sums.data(), sums);
+			return finish_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("avx512f")]] auto sum_of_squares_avx512(float const* values, std::size_t size)
+		   -> float {
+			return dot_avx512(values, values, size);
+		}
+
+		// eight floats at a time widened into one register of eight doubles. the widening is the
+		// zero masked form: gcc 12's _mm512_cvtps_pd passes _mm512_undefined_pd() through, which
+		// -Wmaybe-uninitialized reports once inlined.
+		[[gnu::target("avx512f")]] auto
+		extended_dot_avx512(float const* first, float const* second, std::size_t size) -> double {
+			constexpr auto all = __mmask8{0xFF};
+			auto sums = _mm512_setzero_pd();
+			auto i = std::size_t{0};
+			for (; i + lanes<double> <= size; i += lanes<double>) {
+				auto const first_i = _mm512_maskz_cvtps_pd(all, _mm256_loadu_ps(first + i));
+				auto const second_i = _mm512_maskz_cvtps_pd(all, _mm256_loadu_ps(second + i));
+				sums = _mm512_add_pd(sums, _mm512_mul_pd(first_i, second_i));
+			}
+			auto lane_sums = partial_sums<double>{};
+			_mm512_storeu_pd(lane_sums.data(), sums);
+			return finish_extended_dot(lane_sums, first, second, i, size);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		extended_sum_of_squares_avx512(float const* values, std::size_t size) -> double {
+			return extended_dot_avx512(values, values, size);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		add_avx512(float* values, float const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 16 <= size; i += 16) {
+				auto const values_i = _mm512_loadu_ps(values + i);
+				auto const sum = _mm512_add_ps(values_i, _mm512_loadu_ps(others + i));
+				_mm512_storeu_ps(values + i, sum);
+			}
+			add_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		subtract_avx512(float* values, float const* others, std::size_t size) -> void {
+			auto i = std::size_t{0};
+			for (; i + 16 <= size; i += 16) {
+				auto const values_i = _mm512_loadu_ps(values + i);
+				auto const difference = _mm512_sub_ps(values_i, _mm512_loadu_ps(others + i));
+				_mm512_storeu_ps(values + i, difference);
+			}
+			subtract_scalar(values + i, others + i, size - i);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		multiply_avx512(float* values, float multiplier, std::size_t size) -> void {
+			auto const factor = _mm512_set1_ps(multiplier);
+			auto i = std::size_t{0};
+			for (; i + 16 <= size; i += 16) {
+				_mm512_storeu_ps(values + i, _mm512_mul_ps(_mm512_loadu_ps(values + i), factor));
+			}
+			multiply_scalar(values + i, multiplier, size - i);
+		}
+
+		[[gnu::target("avx512f")]] auto
+		divide_avx512(float* values, float divisor, std::size_t size) -> void {
+			auto const denominator = _mm512_set1_ps(divisor);
+			auto i = std::size_t{0};
+			for (; i + 16 <= size; i += 16) {
+				_mm512_storeu_ps(values + i, _mm512_div_ps(_mm512_loadu_ps(values + i), denominator));
+			}
+			divide_scalar(values + i, divisor, size - i);
+		}
+
+		constexpr auto avx512_kernels = vector_kernels{
+		   dot_avx512,
+		   sum_of_squares_avx512,
+		   add_avx512,
+		   subtract_avx512,
+		   multiply_avx512,
+		   divide_avx512,
+		   dot_avx512,
+		   sum_of_squares_avx512,
+		};
+
+		constexpr auto avx512_float_kernels = basic_vector_kernels<float>{
+		   dot_avx512,
+		   sum_of_squares_avx512,
+		   add_avx512,
+		   subtract_avx512,
+		   multiply_avx512,
+		   divide_avx512,
+		   extended_dot_avx512,
+		   extended_sum_of_squares_avx512,
+		};
+#endif
+
+		auto supports(simd_level level) -> bool {
+#ifdef COMP6771_VECTOR_KERNELS_X86
+			__builtin_cpu_init();
+			switch (level) {
+			case simd_level::scalar: return true;
+			case simd_level::sse2: return __builtin_cpu_supports("sse2") != 0;
+			case simd_level::avx2: return __builtin_cpu_supports("avx2") != 0;
+			case simd_level::avx512: return __builtin_cpu_supports("avx512f") != 0;
+			}
+			return false;
+#else
+			return level == simd_level::scalar;
+#endif
+		}
+
+		auto best_level() -> simd_level {
+			static auto const best = [] {
+				for (auto level : {simd_level::avx512, simd_level::avx2, simd_level::sse2}) {
+					if (supports(level)) {
+						return level;
+					}
+				}
+				return simd_level::scalar;
+			}();
+			return best;
+		}
+	} // namespace
+
+	template<typename Scalar>
+	auto kernels(simd_level level) -> basic_vector_kernels<Scalar> const& {
+#ifdef COMP6771_VECTOR_KERNELS_X86
+		switch (level) {
+		case simd_level::scalar: return pick<Scalar>(scalar_kernels, scalar_float_kernels);
+		case simd_level::sse2: return pick<Scalar>(sse2_kernels, sse2_float_kernels);
+		case simd_level::avx2: return pick<Scalar>(avx2_kernels, avx2_float_kernels);
+		case simd_level::avx512: return pick<Scalar>(avx512_kernels, avx512_float_kernels);
+		}
+#endif
+		(void)level;
+		return pick<Scalar>(scalar_kernels, scalar_float_kernels);
+	}
+
+	template<typename Scalar>
+	auto kernels() -> basic_vector_kernels<Scalar> const& {
+		static auto const& best = kernels<Scalar>(best_level());
+		return best;
+	}
+
+	template auto kernels<double>(simd_level level) -> basic_vector_kernels<double> const&;
+	template auto kernels<float>(simd_level level) -> basic_vector_kernels<float> const&;
+	template auto kernels<double>() -> basic_vector_kernels<double> const&;
+	template auto kernels<float>() -> basic_vector_kernels<float> const&;
+
+	auto kernels(simd_level level) -> vector_kernels const& {
+		return kernels<double>(level);
+	}
+
+	auto kernels() -> vector_kernels const& {
+		return kernels<double>();
+	}
+
+	auto supported_simd_levels() -> std::vector<simd_level> {
+		auto levels = std::vector<simd_level>();
+		for (auto level :
+		     {simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512}) {
+			if (supports(level)) {
+				levels.push_back(level);
+			}
+		}
+		return levels;
+	}
+} // namespace comp6771
@@ -0,0 +1,127 @@
+#ifndef COMP6771_TEST_EUCLIDEAN_VECTOR_ALLOCATION_COUNTER_HPP
+#define COMP6771_TEST_EUCLIDEAN_VECTOR_ALLOCATION_COUNTER_HPP
+
+// replaces the whole family of global operator new and delete (single and array, sized, nothrow
+// and aligned) with versions over malloc, aligned_alloc and free that count every allocation.
+// replacing only some of them mixes allocators: under the sanitizers the rest come from the
+// sanitizer's own operator new, which then reaches free, and are not counted either.
+//
+// replacements cannot be inline, so include this in exactly one translation unit of a test binary.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace allocation_counter {
+	// operator new calls of any kind so far
+	inline auto allocations = std::size_t{0};
+
+	inline auto allocate(std::size_t size, std::size_t alignment) noexcept -> void* {
+		++allocations;
+		// neither malloc nor aligned_alloc has to give a pointer for 0 bytes
+		size = size == 0 ? 1 : size;
+		if (alignment <= alignof(std::max_align_t)) {
+			return std::malloc(size);
+		}
+		// aligned_alloc wants a multiple of the alignment
+		return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+	}
+
+	inline auto allocate_or_throw(std::size_t size, std::size_t alignment) -> void* {
+		if (auto* memory = allocate(size, alignment)) {
+			return memory;
+		}
+		throw std::bad_alloc();
+	}
+} // namespace allocation_counter
+
+auto operator new(std::size_t size) -> void* {
+	return allocation_counter::allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+auto operator new[](std::size_t size) -> void* {
+	return allocation_counter::allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+auto operator new(std::size_t size, std::nothrow_t const& /*tag*/) noexcept -> void* {
+	return allocation_counter::allocate(size, alignof(std::max_align_t));
+}
+
+auto operator new[](std::size_t size, std::nothrow_t const& /*tag*/) noexcept -> void* {
+	return allocation_counter::allocate(size, alignof(std::max_align_t));
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+	return allocation_counter::allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+	return allocation_counter::allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const& /*tag*/) noexcept
+   -> void* {
+	return allocation_counter::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+auto operator new[](std::size_t size,
+                    std::align_val_t alignment,
+                    std::nothrow_t const& /*tag*/) noexcept -> void* {
+	return allocation_counter::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+auto operator delete(void* memory) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete(void* memory, std::size_t /*size*/) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory, std::size_t /*size*/) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete(void* memory, std::nothrow_t const& /*tag*/) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory, std::nothrow_t const& /*tag*/) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete(void* memory, std::align_val_t /*alignment*/) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory, std::align_val_t /*alignment*/) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete(void* memory, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+   -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+   -> void {
+	std::free(memory);
+}
+
+auto operator delete(void* memory,
+                     std::align_val_t /*alignment*/,
+                     std::nothrow_t const& /*tag*/) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete[](void* memory,
+                       std::align_val_t /*alignment*/,
+                       std::nothrow_t const& /*tag*/) noexcept -> void {
+	std::free(memory);
+}
+
+#endif // COMP6771_TEST_EUCLIDEAN_VECTOR_ALLOCATION_COUNTER_HPP
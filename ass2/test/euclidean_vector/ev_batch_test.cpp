@@ -0,0 +1,159 @@
+/*
+rationale:
+Each section checks euclidean_vector_batch against euclidean_vectors holding the same rows. The
+batched operations use the same kernels as the one vector versions, so their results are compared
+exactly. Dimensions that are not a multiple of the row padding (and more rows than the first
+capacity) are used so that the padding and the growth of the buffer are both exercised. Rows of
+parallel_reduction_threshold dimensions are checked too, since from there the one vector versions
+reduce across threads and the batch must do the same.
+*/
+
+#include <comp6771/euclidean_vector_batch.hpp>
+#include <comp6771/parallel_reduction.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+	auto random_vector(std::mt19937& engine, int dimensions) -> comp6771::euclidean_vector {
+		auto magnitude = std::uniform_real_distribution<double>(-10, 10);
+		auto vector = comp6771::euclidean_vector(dimensions);
+		for (auto i = 0; i < dimensions; i++) {
+			vector[i] = magnitude(engine);
+		}
+		return vector;
+	}
+} // namespace
+
+TEST_CASE("euclidean_vector_batch keeps rows in one buffer and matches euclidean_vector") {
+	constexpr auto dimensions = 13;
+	constexpr auto size = 37;
+	auto engine = std::mt19937(6771);
+	auto vectors = std::vector<comp6771::euclidean_vector>();
+	auto batch = comp6771::euclidean_vector_batch(dimensions);
+	for (auto i = 0; i < size; i++) {
+		vectors.push_back(random_vector(engine, dimensions));
+		batch.push_back(vectors.back());
+	}
+	auto const query = random_vector(engine, dimensions);
+
+	SECTION("rows are aligned views of the buffer") {
+		CHECK(batch.size() == size);
+		CHECK(batch.dimensions() == dimensions);
+		CHECK(batch.stride() == 16);
+		for (auto i = 0; i < size; i++) {
+			auto const address = reinterpret_cast<std::uintptr_t>(batch[i].data());
+			CHECK(address % comp6771::euclidean_vector_batch::row_alignment == 0);
+			CHECK(batch[i] == vectors[static_cast<std::size_t>(i)]);
+		}
+		CHECK(batch[1].data() == batch[0].data() + batch.stride());
+		CHECK(comp6771::euclidean_vector_batch(4, 3)[2] == comp6771::euclidean_vector(4));
+		CHECK_THROWS_WITH(batch.at(size),
+		                  "Index 37 is not valid for this euclidean_vector_batch object");
+		CHECK_THROWS_WITH(batch.push_back(comp6771::euclidean_vector(2)),
+		                  "Dimensions of LHS(13) and RHS(2) do not match");
+
+		// a row of the batch itself, while the buffer has to grow
+		auto copy = comp6771::euclidean_vector_batch(dimensions);
+		copy.push_back(vectors[0]);
+		copy.push_back(copy[0]);
+		CHECK(copy[1] == vectors[0]);
+	}
+
+	SECTION("batched dot and norms are the same as one at a time") {
+		auto results = std::vector<double>(size);
+		comp6771::dot(batch, query, results);
+		for (auto i = 0; i < size; i++) {
+			CHECK(results[static_cast<std::size_t>(i)]
+			      == comp6771::dot(vectors[static_cast<std::size_t>(i)], query));
+		}
+		comp6771::dot(batch, batch, results);
+		for (auto i = 0; i < size; i++) {
+			auto const& vector = vectors[static_cast<std::size_t>(i)];
+			CHECK(results[static_cast<std::size_t>(i)] == comp6771::dot(vector, vector));
+		}
+		comp6771::euclidean_norms(batch, results);
+		for (auto i = 0; i < size; i++) {
+			CHECK(results[static_cast<std::size_t>(i)]
+			      == comp6771::euclidean_norm(vectors[static_cast<std::size_t>(i)]));
+		}
+		CHECK_THROWS_WITH(comp6771::dot(batch, comp6771::euclidean_vector(2), results),
+		                  "Dimensions of LHS(13) and RHS(2) do not match");
+		auto const empty = comp6771::euclidean_vector_batch(dimensions);
+		CHECK_THROWS_WITH(comp6771::dot(batch, empty, results),
+		                  "Sizes of LHS(37) and RHS(0) do not match");
+
+		// too few results throw rather than write past the end
+		auto const short_results = std::span<double>(results).first(size - 1);
+		CHECK_THROWS_WITH(comp6771::dot(batch, query, short_results),
+		                  "Results of size 36 cannot hold 37 rows");
+		CHECK_THROWS_WITH(comp6771::dot(batch, batch, short_results),
+		                  "Results of size 36 cannot hold 37 rows");
+		CHECK_THROWS_WITH(comp6771::euclidean_norms(batch, short_results),
+		                  "Results of size 36 cannot hold 37 rows");
+	}
+
+	SECTION("normalize and scale change every row") {
+		auto scaled = batch;
+		scaled *= 3;
+		scaled /= 2;
+		for (auto i = 0; i < size; i++) {
+			auto const& vector = vectors[static_cast<std::size_t>(i)];
+			CHECK(scaled[i] == comp6771::euclidean_vector(vector * 3 / 2));
+		}
+		CHECK_THROWS_WITH(scaled /= 0, "Invalid vector division by 0");
+
+		batch.push_back(comp6771::euclidean_vector(dimensions));
+		comp6771::normalize(batch);
+		for (auto i = 0; i < size; i++) {
+			CHECK(batch[i] == comp6771::unit(vectors[static_cast<std::size_t>(i)]));
+		}
+		// a zero row has no unit vector and stays as it is
+		CHECK(batch[size] == comp6771::euclidean_vector(dimensions));
+	}
+
+	SECTION("negative dimensions, sizes and capacities throw") {
+		CHECK_THROWS_WITH(comp6771::euclidean_vector_batch(-1), "Invalid batch dimensions -1");
+		CHECK_THROWS_WITH(comp6771::euclidean_vector_batch(-1, 3), "Invalid batch dimensions -1");
+		CHECK_THROWS_WITH(comp6771::euclidean_vector_batch(dimensions, -2), "Invalid batch size -2");
+		CHECK_THROWS_WITH(batch.reserve(-1), "Invalid batch capacity -1");
+		CHECK(batch.size() == size);
+		CHECK(comp6771::euclidean_vector_batch(0, 2).size() == 2);
+	}
+
+	SECTION("copies own their rows and moves take them") {
+		auto copy = batch;
+		copy[0][0] = 1000;
+		CHECK(batch[0] == vectors[0]);
+		auto const* rows = batch[0].data();
+		auto moved = std::move(batch);
+		CHECK(moved[0].data() == rows);
+		CHECK(moved.size() == size);
+		batch = std::move(copy);
+		CHECK(batch[0][0] == 1000);
+	}
+}
+
+TEST_CASE("rows long enough for the threads give the same bits as one vector") {
+	constexpr auto dimensions = static_cast<int>(comp6771::parallel_reduction_threshold);
+	auto engine = std::mt19937(6771);
+	auto const first = random_vector(engine, dimensions);
+	auto const second = random_vector(engine, dimensions);
+	auto batch = comp6771::euclidean_vector_batch(dimensions);
+	batch.push_back(first);
+	batch.push_back(second);
+
+	auto results = std::vector<double>(2);
+	comp6771::dot(batch, second, results);
+	CHECK(results[0] == comp6771::dot(first, second));
+	comp6771::euclidean_norms(batch, results);
+	CHECK(results[0] == comp6771::euclidean_norm(first));
+	CHECK(results[1] == comp6771::euclidean_norm(second));
+	comp6771::normalize(batch);
+	CHECK(batch[0] == comp6771::unit(first));
+}
@@ -0,0 +1,166 @@
+/*
+rationale:
+Each section checks one part of +, -, * and /: the euclidean_vectors they give for vector operands,
+and the expression templates they give once an operand is lazy. The results are compared against
+the same arithmetic done by hand on std::vector<double>, element by element and in the same order,
+so they must be exactly equal. Code written against operators that return euclidean_vectors (auto
+results, returning a sum of locals, members of the result) is checked to still work. Allocations
+are counted by replacing the global operator new (allocation_counter.hpp), which checks that a
+chain allocates once and a lazy expression only for its result.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "allocation_counter.hpp"
+
+using allocation_counter::allocations;
+
+TEST_CASE("expression templates (functionality, allocations and exceptions)") {
+	auto const a_magnitudes = std::vector<double>{1.5, -2.25, 3.0, 0.1};
+	auto const b_magnitudes = std::vector<double>{0.3, 4.0, -1.0, 2.7};
+	auto const c_magnitudes = std::vector<double>{-7.0, 0.5, 0.2, 1.1};
+	auto const a = comp6771::euclidean_vector(a_magnitudes.begin(), a_magnitudes.end());
+	auto const b = comp6771::euclidean_vector(b_magnitudes.begin(), b_magnitudes.end());
+	auto const c = comp6771::euclidean_vector(c_magnitudes.begin(), c_magnitudes.end());
+	// applies the arithmetic by hand to each element (x from a, y from b, z from c)
+	auto const by_hand = [&](auto const& arithmetic) {
+		auto magnitudes = std::vector<double>();
+		for (auto i = std::size_t{0}; i < a_magnitudes.size(); i++) {
+			magnitudes.push_back(arithmetic(a_magnitudes[i], b_magnitudes[i], c_magnitudes[i]));
+		}
+		return comp6771::euclidean_vector(magnitudes.begin(), magnitudes.end());
+	};
+
+	SECTION("compound expressions give the same values as element by element arithmetic") {
+		auto const result = comp6771::euclidean_vector(a + b * 2 - c / 4 + 3 * (a - b));
+		CHECK(result == by_hand([](double x, double y, double z) {
+			      return x + y * 2 - z / 4 + (x - y) * 3;
+		      }));
+	}
+
+	SECTION("a chain allocates once, and a lazy expression only for its result") {
+		// big enough not to fit in the inline storage, so the result has to allocate once
+		auto const dimensions = comp6771::euclidean_vector::inline_capacity + 4;
+		auto const big_a = comp6771::euclidean_vector(dimensions, 1.5);
+		auto const big_b = comp6771::euclidean_vector(dimensions, 0.25);
+		auto const big_c = comp6771::euclidean_vector(dimensions, -3.0);
+		auto const expected = comp6771::euclidean_vector(dimensions, 1.5 + 0.25 * 2 + 3.0);
+
+		// big_b * 2 allocates, and the rest of the chain works in its storage
+		auto const before = allocations;
+		auto const eager = big_a + big_b * 2 - big_c;
+		auto const after_eager = allocations;
+		auto const fused =
+		   comp6771::euclidean_vector(comp6771::lazy(big_a) + comp6771::lazy(big_b) * 2 - big_c);
+		auto const after_fused = allocations;
+		CHECK(after_eager - before == 1);
+		CHECK(after_fused - after_eager == 1);
+		CHECK(eager == expected);
+		CHECK(fused == expected);
+	}
+
+	SECTION("lazy expressions convert wherever a euclidean_vector is expected") {
+		auto const lazy_a = comp6771::lazy(a);
+		CHECK(lazy_a + b == by_hand([](double x, double y, double /*z*/) { return x + y; }));
+		CHECK(comp6771::dot(lazy_a - a, b) == 0.0);
+		CHECK(comp6771::euclidean_norm(comp6771::lazy(c) * 0) == 0.0);
+		CHECK(comp6771::unit(comp6771::lazy(b) * 2) == comp6771::unit(b));
+		auto output = std::ostringstream();
+		output << lazy_a * 2;
+		CHECK(output.str() == "[3 -4.5 6 0.2]");
+	}
+
+	SECTION("lazy expressions have the const members of a euclidean_vector") {
+		auto const sum = comp6771::euclidean_vector(a + b);
+		auto const lazy_a = comp6771::lazy(a);
+		CHECK(static_cast<std::vector<double>>(lazy_a + b) == static_cast<std::vector<double>>(sum));
+		auto const doubled = comp6771::euclidean_vector(a * 2);
+		CHECK(static_cast<std::list<double>>(lazy_a * 2) == static_cast<std::list<double>>(doubled));
+		CHECK((lazy_a + b).at(0) == sum.at(0));
+		CHECK((comp6771::lazy(b) / 4).at(3) == b_magnitudes[3] / 4);
+		CHECK_THROWS_WITH((lazy_a + b).at(4),
+		                  "Index 4 is not valid for this euclidean_vector object");
+		CHECK_THROWS_WITH(lazy_a.at(-1), "Index -1 is not valid for this euclidean_vector object");
+	}
+
+	SECTION("operators on vectors give euclidean_vectors, so code using them is unchanged") {
+		static_assert(std::is_same_v<decltype(a + b), comp6771::euclidean_vector>);
+		static_assert(std::is_same_v<decltype(a - b), comp6771::euclidean_vector>);
+		static_assert(std::is_same_v<decltype(a * 2), comp6771::euclidean_vector>);
+		static_assert(std::is_same_v<decltype(2 * a), comp6771::euclidean_vector>);
+		static_assert(std::is_same_v<decltype(a / 2), comp6771::euclidean_vector>);
+		auto const sum = by_hand([](double x, double y, double /*z*/) { return x + y; });
+		auto const difference = by_hand([](double x, double y, double /*z*/) { return x - y; });
+
+		// the result owns its magnitudes: it outlives the operands and ignores later changes
+		auto const add_locals = [](double x) {
+			auto const first = comp6771::euclidean_vector(20, x);
+			auto const second = comp6771::euclidean_vector(20, 1.0);
+			return first + second;
+		};
+		CHECK(add_locals(2) == comp6771::euclidean_vector(20, 3.0));
+		auto vector_a = a;
+		auto kept = vector_a + b;
+		vector_a += b;
+		CHECK(kept == sum);
+		kept *= 2;
+		CHECK(kept == sum * 2);
+
+		CHECK(-(a + b) == sum * -1);
+		CHECK(+(a + b) == sum);
+		CHECK(((a + b) += a) == sum + a);
+		CHECK((a + b).magnitudes() == sum.magnitudes());
+		CHECK(static_cast<std::vector<double>>(a + b) == sum.magnitudes());
+		CHECK(static_cast<std::list<double>>(a * 2).size() == a_magnitudes.size());
+		CHECK((a + b).at(0) == sum.at(0));
+		for (auto const add : {true, false}) {
+			CHECK((add ? a + b : a - b) == (add ? sum : difference));
+		}
+	}
+
+	SECTION("assignment evaluates in place, even when the expression reads the target") {
+		auto target = a;
+		auto const before = allocations;
+		target = comp6771::lazy(b) - target;
+		target += comp6771::lazy(a) * 2;
+		target -= comp6771::lazy(c) / 2;
+		auto const after = allocations;
+		CHECK(after == before);
+		CHECK(target == by_hand([](double x, double y, double z) {
+			      return (y - x) + x * 2 - z / 2;
+		      }));
+		CHECK((target = b - target) == by_hand([](double x, double y, double z) {
+			      return y - ((y - x) + x * 2 - z / 2);
+		      }));
+
+		// a different number of dimensions needs a new allocation
+		auto small = comp6771::euclidean_vector(2);
+		small = a + b;
+		CHECK(small == a + b);
+	}
+
+	SECTION("temporaries are kept alive by the expression") {
+		auto const expression = comp6771::lazy(comp6771::euclidean_vector(4, 1.0)) + a;
+		auto const result = comp6771::euclidean_vector(expression);
+		CHECK(result == by_hand([](double x, double /*y*/, double /*z*/) { return 1.0 + x; }));
+	}
+
+	SECTION("exceptions are thrown where the operator is written") {
+		auto const d = comp6771::euclidean_vector{1.0, 2.0};
+		CHECK_THROWS_WITH(a + b * 2 - d, "Dimensions of LHS(4) and RHS(2) do not match");
+		CHECK_THROWS_WITH((a + b) / 0, "Invalid vector division by 0");
+		auto target = comp6771::euclidean_vector(2);
+		CHECK_THROWS_WITH(target += a * 2, "Dimensions of LHS(2) and RHS(4) do not match");
+		CHECK_THROWS_WITH(comp6771::lazy(a) - d, "Dimensions of LHS(4) and RHS(2) do not match");
+		CHECK_THROWS_WITH(comp6771::lazy(a) / 0, "Invalid vector division by 0");
+		CHECK_NOTHROW(a * 3 + 3 * b);
+	}
+}
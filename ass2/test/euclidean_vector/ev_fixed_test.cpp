@@ -0,0 +1,102 @@
+/*
+rationale:
+Each section checks a part of fixed_euclidean_vector. The constexpr operations are checked with
+static_asserts so that they are known to run at compile time, and size mismatches are checked with
+requires expressions, since they are meant not to compile at all. The rest compares results and
+exceptions against the dynamic euclidean_vector doing the same thing.
+*/
+
+#include <comp6771/fixed_euclidean_vector.hpp>
+
+#include <array>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <sstream>
+#include <type_traits>
+
+namespace {
+	template<typename First, typename Second>
+	concept addable = requires(First first, Second second) {
+		first + second;
+	};
+
+	template<typename First, typename Second>
+	concept dottable = requires(First first, Second second) {
+		comp6771::dot(first, second);
+	};
+
+	using vector2 = comp6771::fixed_euclidean_vector<2>;
+	using vector3 = comp6771::fixed_euclidean_vector<3>;
+
+	constexpr auto cross_sum() -> vector3 {
+		auto sum = vector3{1, 2, 3} + vector3{4, 5, 6} * 2;
+		sum -= vector3(1);
+		sum /= 2;
+		return -sum;
+	}
+} // namespace
+
+TEST_CASE("fixed_euclidean_vector works at compile time and matches euclidean_vector") {
+	SECTION("operations are constexpr") {
+		static_assert(vector3{1, 2, 3}[2] == 3);
+		static_assert(vector3()[0] == 0 && vector3(7)[1] == 7);
+		static_assert(vector3::dimensions() == 3);
+		static_assert(cross_sum() == vector3{-4, -5.5, -7});
+		static_assert(2 * vector2{1, 2} == vector2{1, 2} * 2);
+		static_assert(vector2{1, 2} != vector2{2, 1});
+		static_assert(comp6771::dot(vector3{1, 2, 3}, vector3{4, 5, 6}) == 32);
+		static_assert(std::is_trivially_copyable_v<vector3>);
+		static_assert(sizeof(vector3) == 3 * sizeof(double));
+		CHECK(cross_sum() == vector3{-4, -5.5, -7});
+	}
+
+	SECTION("size mismatches do not compile") {
+		static_assert(addable<vector3, vector3>);
+		static_assert(not addable<vector2, vector3>);
+		static_assert(dottable<vector2, vector2>);
+		static_assert(not dottable<vector3, vector2>);
+		static_assert(not std::is_constructible_v<vector3, double, double>);
+		static_assert(not std::is_convertible_v<double, vector3>);
+	}
+
+	SECTION("results match euclidean_vector") {
+		auto const fixed = vector3{3, -4, 12};
+		auto const dynamic = comp6771::euclidean_vector{3, -4, 12};
+		auto const other = vector3{0.5, 0.25, -2};
+		auto const dynamic_other = comp6771::euclidean_vector{0.5, 0.25, -2};
+
+		CHECK(static_cast<comp6771::euclidean_vector>(fixed) == dynamic);
+		CHECK(vector3(dynamic) == fixed);
+		CHECK(static_cast<comp6771::euclidean_vector>(fixed + other)
+		      == comp6771::euclidean_vector(dynamic + dynamic_other));
+		CHECK(static_cast<comp6771::euclidean_vector>(fixed / 3)
+		      == comp6771::euclidean_vector(dynamic / 3));
+		CHECK(comp6771::dot(fixed, other) == comp6771::dot(dynamic, dynamic_other));
+		CHECK(comp6771::euclidean_norm(fixed) == comp6771::euclidean_norm(dynamic));
+		CHECK(comp6771::euclidean_norm(fixed) == 13);
+		CHECK(static_cast<comp6771::euclidean_vector>(comp6771::unit(fixed))
+		      == comp6771::unit(dynamic));
+		CHECK(static_cast<std::array<double, 3>>(fixed) == std::array<double, 3>{3, -4, 12});
+
+		auto fixed_output = std::ostringstream();
+		fixed_output << fixed;
+		auto dynamic_output = std::ostringstream();
+		dynamic_output << dynamic;
+		CHECK(fixed_output.str() == dynamic_output.str());
+	}
+
+	SECTION("errors throw what euclidean_vector throws") {
+		auto vector = vector3{1, 2, 3};
+		CHECK_THROWS_WITH(vector.at(3), "Index 3 is not valid for this euclidean_vector object");
+		CHECK_THROWS_WITH(vector.at(-1), "Index -1 is not valid for this euclidean_vector object");
+		vector.at(1) = 5;
+		CHECK(vector == vector3{1, 5, 3});
+		CHECK_THROWS_WITH(vector / 0, "Invalid vector division by 0");
+		CHECK_THROWS_WITH(comp6771::unit(vector3()),
+		                  "euclidean_vector with zero euclidean normal does not have a unit vector");
+		CHECK_THROWS_WITH(comp6771::unit(comp6771::fixed_euclidean_vector<0>()),
+		                  "euclidean_vector with no dimensions does not have a unit vector");
+		CHECK_THROWS_WITH(vector3(comp6771::euclidean_vector(2)),
+		                  "Dimensions of LHS(3) and RHS(2) do not match");
+	}
+}
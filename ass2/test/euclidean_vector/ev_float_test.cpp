@@ -0,0 +1,134 @@
+/*
+rationale:
+Each section checks basic_euclidean_vector<float> against what euclidean_vector (now an alias of
+basic_euclidean_vector<double>) does. Small whole numbers are used for the arithmetic so that every
+result is exact in float and can be compared exactly. Mixing floats and doubles in one operation is
+checked not to compile, and the extended reductions are checked to add up in double: 2^20 copies of
+the same float add up exactly in double but not in float.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+	using float_vector = comp6771::basic_euclidean_vector<float>;
+
+	template<typename First, typename Second>
+	concept addable = requires {
+		std::declval<First>() + std::declval<Second>();
+	};
+
+	template<typename First, typename Second>
+	concept has_dot = requires {
+		comp6771::dot(std::declval<First>(), std::declval<Second>());
+	};
+} // namespace
+
+TEST_CASE("euclidean_vector is templated on the type of its magnitudes") {
+	SECTION("euclidean_vector is the double vector") {
+		static_assert(std::is_same_v<comp6771::euclidean_vector,
+		                             comp6771::basic_euclidean_vector<double>>);
+		static_assert(std::is_same_v<float_vector::value_type, float>);
+		static_assert(sizeof(float_vector) < sizeof(comp6771::euclidean_vector));
+		auto vector = float_vector{1, 2, 3};
+		static_assert(std::is_same_v<decltype(vector[0]), float&>);
+		static_assert(std::is_same_v<decltype(comp6771::dot(vector, vector)), float>);
+		static_assert(std::is_same_v<decltype(comp6771::euclidean_norm(vector)), float>);
+		static_assert(std::is_same_v<decltype(vector + vector)::value_type, float>);
+		static_assert(std::is_same_v<decltype(comp6771::extended_dot(vector, vector)), double>);
+	}
+
+	SECTION("float vectors do what double vectors do") {
+		auto const a = float_vector{3, 4, -2, 8};
+		auto const b = float_vector{1, -1, 6, 0.5};
+		auto const as_double = comp6771::euclidean_vector{3, 4, -2, 8};
+
+		CHECK(float_vector(a + b) == float_vector{4, 3, 4, 8.5});
+		CHECK(float_vector(a - b * 2) == float_vector{1, 6, -14, 7});
+		CHECK(float_vector(a / 2) == float_vector{1.5, 2, -1, 4});
+		CHECK(float_vector(a) + b == float_vector(a + b));
+		CHECK(float_vector(3 * float_vector(b)) == float_vector(b * 3));
+		CHECK(comp6771::dot(a, b) == 3 - 4 - 12 + 4);
+		CHECK(comp6771::euclidean_norm(float_vector{3, 4}) == 5);
+		CHECK(comp6771::unit(float_vector{3, 4}) == float_vector{0.6F, 0.8F});
+		CHECK(comp6771::unit(float_vector{3, 4}) == float_vector(comp6771::unit(
+		                                               comp6771::euclidean_vector{3, 4})));
+
+		auto changed = a;
+		changed += b;
+		changed *= 2;
+		changed -= a;
+		changed /= 4;
+		CHECK(changed == float_vector((a + b * 2) / 4));
+		CHECK(static_cast<std::vector<float>>(changed) == std::vector<float>{1.25, 0.5, 2.5, 2.25});
+
+		auto printed = std::ostringstream();
+		printed << a;
+		auto printed_double = std::ostringstream();
+		printed_double << as_double;
+		CHECK(printed.str() == printed_double.str());
+
+		CHECK_THROWS_WITH(a + float_vector(2), "Dimensions of LHS(4) and RHS(2) do not match");
+		CHECK_THROWS_WITH(a / 0, "Invalid vector division by 0");
+		CHECK_THROWS_WITH(a.at(4), "Index 4 is not valid for this euclidean_vector object");
+		CHECK_THROWS_WITH(comp6771::unit(float_vector(2)),
+		                  "euclidean_vector with zero euclidean normal does not have a unit vector");
+	}
+
+	SECTION("floats and doubles do not mix without a conversion") {
+		static_assert(addable<float_vector, float_vector>);
+		static_assert(not addable<float_vector, comp6771::euclidean_vector>);
+		static_assert(not addable<comp6771::euclidean_vector&&, float_vector const&>);
+		static_assert(has_dot<float_vector, float_vector>);
+		static_assert(not has_dot<float_vector, comp6771::euclidean_vector>);
+		static_assert(not std::is_convertible_v<comp6771::euclidean_vector, float_vector>);
+
+		auto const precise = comp6771::euclidean_vector{0.1, 2};
+		auto const rounded = float_vector(precise);
+		CHECK(rounded[0] == 0.1F);
+		CHECK(rounded[1] == 2);
+		CHECK(comp6771::euclidean_vector(rounded)[0] == static_cast<double>(0.1F));
+	}
+
+	SECTION("views of float memory") {
+		auto magnitudes = std::vector<float>{3, 4, 12};
+		auto view = comp6771::euclidean_vector_view<float>(magnitudes.data(), 3);
+		CHECK(comp6771::euclidean_norm(view) == 13);
+		view *= 2;
+		view += float_vector{1, 1, 1};
+		CHECK(magnitudes == std::vector<float>{7, 9, 25});
+		CHECK(float_vector(view - float_vector{7, 9, 25}) == float_vector(3));
+		auto const vector = float_vector{1, 2, 3};
+		CHECK(comp6771::dot(comp6771::euclidean_vector_view(vector), view) == 7 + 18 + 75);
+	}
+
+	SECTION("extended reductions add up in double") {
+		constexpr auto dimensions = 1 << 20;
+		auto const third = 1.0F / 3;
+		auto const thirds = float_vector(dimensions, third);
+		auto const ones = float_vector(dimensions, 1);
+		// every partial sum holds the same multiple of a 24 bit number, which double keeps exactly
+		auto const expected = dimensions * static_cast<double>(third);
+		CHECK(comp6771::extended_dot(thirds, ones) == expected);
+		auto const in_float = static_cast<double>(comp6771::dot(thirds, ones));
+		CHECK(std::abs(in_float - expected) > 0);
+
+		auto const norm = comp6771::extended_euclidean_norm(thirds);
+		CHECK(norm == std::sqrt(comp6771::extended_dot(thirds, thirds)));
+		CHECK(norm == Approx(std::sqrt(dimensions) * static_cast<double>(third)).epsilon(1e-10));
+
+		// doubles already add up in double
+		auto const doubles = comp6771::euclidean_vector(thirds);
+		CHECK(comp6771::extended_dot(doubles, doubles) == comp6771::dot(doubles, doubles));
+		CHECK(comp6771::extended_euclidean_norm(doubles) == comp6771::euclidean_norm(doubles));
+		CHECK(comp6771::extended_dot(float_vector(0), float_vector(0)) == 0);
+		CHECK_THROWS_WITH(comp6771::extended_dot(thirds, float_vector(2)),
+		                  "Dimensions of LHS(1048576) and RHS(2) do not match");
+	}
+}
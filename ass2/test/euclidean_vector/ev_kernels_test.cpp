@@ -0,0 +1,196 @@
+/*
+rationale:
+Each section checks the simd kernels behind dot, euclidean_norm, +=, -=, *= and /=. Every level the
+cpu supports is run on the same random arrays, over sizes around every register width, and must
+give bit for bit the same results as the scalar level, which is itself checked against the summation
+order the kernels promise. The float kernels (including the ones adding up in double) are checked
+the same way. Finally the euclidean_vector functions are checked to use the kernels.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+#include <comp6771/vector_kernels.hpp>
+
+#include <array>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+	auto random_values(std::size_t size, std::uint64_t seed) -> std::vector<double> {
+		auto rng = std::mt19937_64(seed);
+		auto values = std::vector<double>(size);
+		for (auto& value : values) {
+			value = static_cast<double>(rng() >> 11) * 0x1.0p-53 * 200.0 - 100.0;
+		}
+		return values;
+	}
+
+	// the documented order: eight partial sums, combined pairwise
+	auto reference_dot(std::vector<double> const& first, std::vector<double> const& second)
+	   -> double {
+		auto sums = std::array<double, 8>{};
+		for (auto i = std::size_t{0}; i < first.size(); i++) {
+			sums[i % 8] += first[i] * second[i];
+		}
+		auto const low = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+		auto const high = (sums[4] + sums[5]) + (sums[6] + sums[7]);
+		return low + high;
+	}
+
+	auto random_floats(std::size_t size, std::uint64_t seed) -> std::vector<float> {
+		auto values = std::vector<float>();
+		for (auto value : random_values(size, seed)) {
+			values.push_back(static_cast<float>(value));
+		}
+		return values;
+	}
+
+	// sixteen float partial sums, combined pairwise
+	auto reference_dot(std::vector<float> const& first, std::vector<float> const& second) -> float {
+		auto sums = std::array<float, 16>{};
+		for (auto i = std::size_t{0}; i < first.size(); i++) {
+			sums[i % 16] += first[i] * second[i];
+		}
+		for (auto size = std::size_t{16}; size > 1; size /= 2) {
+			for (auto i = std::size_t{0}; i < size / 2; i++) {
+				sums[i] = sums[2 * i] + sums[2 * i + 1];
+			}
+		}
+		return sums[0];
+	}
+
+	// the double order, on the floats widened to double
+	auto reference_extended_dot(std::vector<float> const& first, std::vector<float> const& second)
+	   -> double {
+		return reference_dot(std::vector<double>(first.begin(), first.end()),
+		                     std::vector<double>(second.begin(), second.end()));
+	}
+
+	auto const sizes =
+	   std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 1000, 4099};
+} // namespace
+
+TEST_CASE("simd kernels (functionality at every supported level)") {
+	auto const levels = comp6771::supported_simd_levels();
+	REQUIRE(levels.front() == comp6771::simd_level::scalar);
+	auto const& scalar = comp6771::kernels(comp6771::simd_level::scalar);
+
+	SECTION("reductions follow the documented order") {
+		for (auto size : sizes) {
+			auto const first = random_values(size, 1);
+			auto const second = random_values(size, 2);
+			CHECK(scalar.dot(first.data(), second.data(), size) == reference_dot(first, second));
+			CHECK(scalar.sum_of_squares(first.data(), size) == reference_dot(first, first));
+		}
+	}
+
+	SECTION("every level gives the same bits as the scalar level") {
+		for (auto level : levels) {
+			auto const& simd = comp6771::kernels(level);
+			for (auto size : sizes) {
+				auto const first = random_values(size, size);
+				auto const second = random_values(size, size + 1);
+				CHECK(simd.dot(first.data(), second.data(), size)
+				      == scalar.dot(first.data(), second.data(), size));
+				CHECK(simd.sum_of_squares(first.data(), size)
+				      == scalar.sum_of_squares(first.data(), size));
+
+				auto const check_elementwise = [&](auto const& apply) {
+					auto expected = first;
+					auto actual = first;
+					apply(scalar, expected.data());
+					apply(simd, actual.data());
+					CHECK(actual == expected);
+				};
+				check_elementwise([&](auto const& kernels, double* values) {
+					kernels.add(values, second.data(), size);
+				});
+				check_elementwise([&](auto const& kernels, double* values) {
+					kernels.subtract(values, second.data(), size);
+				});
+				check_elementwise([&](auto const& kernels, double* values) {
+					kernels.multiply(values, -1.7, size);
+				});
+				check_elementwise([&](auto const& kernels, double* values) {
+					kernels.divide(values, 3.0, size);
+				});
+			}
+		}
+	}
+
+	SECTION("float kernels follow their order and give the same bits at every level") {
+		auto const& scalar_float = comp6771::kernels<float>(comp6771::simd_level::scalar);
+		CHECK(&comp6771::kernels<double>() == &comp6771::kernels());
+		for (auto level : levels) {
+			auto const& simd = comp6771::kernels<float>(level);
+			for (auto size : sizes) {
+				auto const first = random_floats(size, size + 2);
+				auto const second = random_floats(size, size + 3);
+				CHECK(scalar_float.dot(first.data(), second.data(), size)
+				      == reference_dot(first, second));
+				CHECK(scalar_float.extended_dot(first.data(), second.data(), size)
+				      == reference_extended_dot(first, second));
+				CHECK(simd.dot(first.data(), second.data(), size)
+				      == scalar_float.dot(first.data(), second.data(), size));
+				CHECK(simd.sum_of_squares(first.data(), size)
+				      == scalar_float.sum_of_squares(first.data(), size));
+				CHECK(simd.extended_dot(first.data(), second.data(), size)
+				      == scalar_float.extended_dot(first.data(), second.data(), size));
+				CHECK(simd.extended_sum_of_squares(first.data(), size)
+				      == scalar_float.extended_sum_of_squares(first.data(), size));
+
+				auto const check_elementwise = [&](auto const& apply) {
+					auto expected = first;
+					auto actual = first;
+					apply(scalar_float, expected.data());
+					apply(simd, actual.data());
+					CHECK(actual == expected);
+				};
+				check_elementwise([&](auto const& kernels, float* values) {
+					kernels.add(values, second.data(), size);
+				});
+				check_elementwise([&](auto const& kernels, float* values) {
+					kernels.subtract(values, second.data(), size);
+				});
+				check_elementwise([&](auto const& kernels, float* values) {
+					kernels.multiply(values, -1.7F, size);
+				});
+				check_elementwise([&](auto const& kernels, float* values) {
+					kernels.divide(values, 3.0F, size);
+				});
+			}
+		}
+	}
+
+	SECTION("division divides rather than multiplying by the reciprocal") {
+		auto values = std::vector<double>(33, 0.3);
+		comp6771::kernels().divide(values.data(), 3.0, values.size());
+		for (auto value : values) {
+			CHECK(value == 0.3 / 3.0);
+		}
+	}
+
+	SECTION("euclidean_vector uses the kernels") {
+		auto const first_values = random_values(1000, 3);
+		auto const second_values = random_values(1000, 4);
+		auto first = comp6771::euclidean_vector(first_values.begin(), first_values.end());
+		auto const second = comp6771::euclidean_vector(second_values.begin(), second_values.end());
+		CHECK(comp6771::dot(first, second) == reference_dot(first_values, second_values));
+		auto const norm = std::sqrt(reference_dot(first_values, first_values));
+		CHECK(comp6771::euclidean_norm(first) == norm);
+
+		first += second;
+		first -= second;
+		first *= 2.0;
+		first /= 2.0;
+		auto expected = first_values;
+		for (auto i = std::size_t{0}; i < expected.size(); i++) {
+			expected[i] = ((expected[i] + second_values[i]) - second_values[i]) * 2.0 / 2.0;
+		}
+		CHECK(static_cast<std::vector<double>>(first) == expected);
+		CHECK_THROWS_WITH(first /= 0, "Invalid vector division by 0");
+	}
+}
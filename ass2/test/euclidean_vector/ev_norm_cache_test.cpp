@@ -0,0 +1,83 @@
+/*
+rationale:
+Each section checks the cached euclidean norm. Several threads call euclidean_norm on one shared
+const vector at once and must all see the norm a private copy gives (this is meant to be run under
+thread sanitizer too), every way of changing the magnitudes must make the next call work the norm
+out again, and the cache must no longer be reachable from outside the class.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+	template<typename T>
+	concept exposes_cache = requires(T vector) {
+		vector.find_normal;
+		vector.normal;
+	};
+} // namespace
+
+TEST_CASE("the cached norm is private and safe to share between threads") {
+	SECTION("the cache fields are private") {
+		static_assert(not exposes_cache<comp6771::euclidean_vector>);
+	}
+
+	SECTION("threads sharing a const vector all get the norm") {
+		constexpr auto dimensions = 4099;
+		auto values = comp6771::euclidean_vector(dimensions);
+		for (auto i = 0; i < dimensions; i++) {
+			values[i] = std::sin(i);
+		}
+		auto const expected = comp6771::euclidean_norm(comp6771::euclidean_vector(values));
+		auto const& shared = values;
+
+		constexpr auto thread_count = 8;
+		auto results = std::vector<double>(thread_count);
+		{
+			auto threads = std::vector<std::jthread>();
+			for (auto t = 0; t < thread_count; t++) {
+				threads.emplace_back([&shared, &results, t] {
+					auto norm = 0.0;
+					for (auto i = 0; i < 1000; i++) {
+						norm = comp6771::euclidean_norm(shared);
+					}
+					results[static_cast<std::size_t>(t)] = norm;
+				});
+			}
+		}
+		for (auto const norm : results) {
+			CHECK(norm == expected);
+		}
+		CHECK(comp6771::euclidean_norm(shared) == expected);
+	}
+
+	SECTION("every change makes the norm be worked out again") {
+		auto vector = comp6771::euclidean_vector{3, 4};
+		CHECK(comp6771::euclidean_norm(vector) == 5);
+		vector.at(0) = 0;
+		CHECK(comp6771::euclidean_norm(vector) == 4);
+		vector[1] = 1;
+		CHECK(comp6771::euclidean_norm(vector) == 1);
+		vector += comp6771::euclidean_vector{3, 3};
+		CHECK(comp6771::euclidean_norm(vector) == 5);
+		vector *= 2;
+		CHECK(comp6771::euclidean_norm(vector) == 10);
+		vector = vector - comp6771::euclidean_vector{0, 8};
+		CHECK(comp6771::euclidean_norm(vector) == 6);
+
+		auto copy = vector;
+		CHECK(comp6771::euclidean_norm(copy) == 6);
+		copy = comp6771::euclidean_vector{5, 12};
+		CHECK(comp6771::euclidean_norm(copy) == 13);
+		auto moved = std::move(copy);
+		CHECK(comp6771::euclidean_norm(moved) == 13);
+		// NOLINTNEXTLINE(bugprone-use-after-move)
+		CHECK(comp6771::euclidean_norm(copy) == 0);
+	}
+}
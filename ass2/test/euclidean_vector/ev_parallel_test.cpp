@@ -0,0 +1,120 @@
+/*
+rationale:
+Each section checks the reductions that are split across threads. The same vectors are reduced with
+several thread counts (including more threads than there is work for) and every result must be the
+same bits. dot and euclidean_norm are checked to give the serial kernel's result one dimension below
+parallel_reduction_threshold and the parallel result at it. Accuracy is checked on millions of
+copies of 1/3 in float, whose exact sum is known: one long serial sum drifts visibly while the
+blocked, pairwise sum stays within a few roundings.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+#include <comp6771/parallel_reduction.hpp>
+#include <comp6771/vector_kernels.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+	template<typename Scalar>
+	auto make_magnitudes(std::size_t size, double offset) -> std::vector<Scalar> {
+		auto magnitudes = std::vector<Scalar>(size);
+		for (auto i = std::size_t{0}; i < size; ++i) {
+			magnitudes[i] = static_cast<Scalar>(std::sin(static_cast<double>(i) + offset));
+		}
+		return magnitudes;
+	}
+} // namespace
+
+TEST_CASE("reductions split across threads are deterministic") {
+	SECTION("the result does not depend on the number of threads") {
+		// several tasks of blocks, and a last block that is not full
+		constexpr auto size = comp6771::reduction_block * 300 + 123;
+		auto const a = make_magnitudes<double>(size, 0.5);
+		auto const b = make_magnitudes<double>(size, 1.5);
+		auto const a_view = comp6771::euclidean_vector_view(a.data(), static_cast<int>(size));
+		auto const b_view = comp6771::euclidean_vector_view(b.data(), static_cast<int>(size));
+		auto const floats = make_magnitudes<float>(size, 2.5);
+		auto const float_view =
+		   comp6771::euclidean_vector_view(floats.data(), static_cast<int>(size));
+
+		auto const dot = comp6771::parallel_dot(a_view, b_view, 1);
+		auto const norm = comp6771::parallel_euclidean_norm(a_view, 1);
+		auto const float_norm = comp6771::parallel_euclidean_norm(float_view, 1);
+		auto const extended = comp6771::parallel_extended_dot(floats.data(), floats.data(), size, 1);
+		for (auto threads : {0U, 2U, 3U, 8U, 1000U}) {
+			CHECK(comp6771::parallel_dot(a_view, b_view, threads) == dot);
+			CHECK(comp6771::parallel_euclidean_norm(a_view, threads) == norm);
+			CHECK(comp6771::parallel_euclidean_norm(float_view, threads) == float_norm);
+			CHECK(comp6771::parallel_extended_dot(floats.data(), floats.data(), size, threads)
+			      == extended);
+		}
+		CHECK(dot == Approx(comp6771::dot(a_view, b_view)).epsilon(1e-12));
+		CHECK(norm == Approx(comp6771::euclidean_norm(a_view)).epsilon(1e-12));
+		CHECK(norm * norm == Approx(comp6771::parallel_sum_of_squares(a.data(), size, 4)));
+	}
+
+	SECTION("up to one block is the serial kernel") {
+		auto const a = make_magnitudes<double>(comp6771::reduction_block, 0.5);
+		auto const b = make_magnitudes<double>(comp6771::reduction_block, 1.5);
+		auto const& kernels = comp6771::kernels();
+		CHECK(comp6771::parallel_dot(a.data(), b.data(), a.size(), 4)
+		      == kernels.dot(a.data(), b.data(), a.size()));
+		CHECK(comp6771::parallel_sum_of_squares(a.data(), 7, 4)
+		      == kernels.sum_of_squares(a.data(), 7));
+		CHECK(comp6771::parallel_dot(a.data(), b.data(), 0, 4) == 0);
+		CHECK(comp6771::parallel_euclidean_norm(comp6771::euclidean_vector(0)) == 0);
+	}
+
+	SECTION("dot and euclidean_norm switch to the threads at the threshold") {
+		constexpr auto size = comp6771::parallel_reduction_threshold;
+		auto const a = make_magnitudes<double>(size, 0.5);
+		auto const b = make_magnitudes<double>(size, 1.5);
+		auto const& kernels = comp6771::kernels();
+
+		auto const below = comp6771::euclidean_vector_view(a.data(), static_cast<int>(size - 1));
+		auto const below_b = comp6771::euclidean_vector_view(b.data(), static_cast<int>(size - 1));
+		CHECK(comp6771::dot(below, below_b) == kernels.dot(a.data(), b.data(), size - 1));
+		CHECK(comp6771::euclidean_norm(below)
+		      == std::sqrt(kernels.sum_of_squares(a.data(), size - 1)));
+
+		auto const at = comp6771::euclidean_vector_view(a.data(), static_cast<int>(size));
+		auto const at_b = comp6771::euclidean_vector_view(b.data(), static_cast<int>(size));
+		CHECK(comp6771::dot(at, at_b) == comp6771::parallel_dot(at, at_b, 1));
+		CHECK(comp6771::euclidean_norm(at) == comp6771::parallel_euclidean_norm(at, 1));
+		CHECK(comp6771::extended_dot(at, at_b) == comp6771::parallel_dot(at, at_b, 3));
+
+		// a vector caches the parallel norm
+		auto const vector = comp6771::euclidean_vector(at);
+		CHECK(comp6771::euclidean_norm(vector) == comp6771::parallel_euclidean_norm(at, 2));
+		CHECK(comp6771::euclidean_norm(vector) == comp6771::parallel_euclidean_norm(vector, 5));
+		CHECK(comp6771::dot(vector, comp6771::euclidean_vector(at_b))
+		      == comp6771::parallel_dot(at, at_b, 2));
+	}
+
+	SECTION("blocks added pairwise stay accurate where one long sum does not") {
+		constexpr auto size = std::size_t{1} << 22;
+		auto const third = 1.0F / 3;
+		auto const thirds = std::vector<float>(size, third);
+		auto const ones = std::vector<float>(size, 1);
+		auto const expected = static_cast<double>(size) * static_cast<double>(third);
+
+		auto const serial = comp6771::kernels<float>().dot(thirds.data(), ones.data(), size);
+		auto const parallel = comp6771::parallel_dot(thirds.data(), ones.data(), size, 4);
+		CHECK(std::abs(static_cast<double>(serial) - expected) / expected > 1e-4);
+		CHECK(std::abs(static_cast<double>(parallel) - expected) / expected < 1e-6);
+		CHECK(comp6771::parallel_extended_dot(thirds.data(), ones.data(), size, 4) == expected);
+	}
+
+	SECTION("errors are the same as for dot") {
+		auto const a = comp6771::euclidean_vector(3);
+		auto const b = comp6771::euclidean_vector(2);
+		CHECK_THROWS_WITH(comp6771::parallel_dot(a, b, 2),
+		                  "Dimensions of LHS(3) and RHS(2) do not match");
+		CHECK(comp6771::parallel_dot(comp6771::basic_euclidean_vector<float>{1, 2},
+		                             comp6771::basic_euclidean_vector<float>{3, 4})
+		      == 11);
+	}
+}
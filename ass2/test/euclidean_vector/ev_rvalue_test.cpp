@@ -0,0 +1,111 @@
+/*
+rationale:
+Each section checks that an operator given a temporary euclidean_vector works in that vector's
+storage instead of allocating a new one. Vectors bigger than inline_capacity are used so that their
+magnitudes are on the heap: the result must hold the same block (compared by address) and the
+global operator new, replaced to count calls (allocation_counter.hpp), must not be called. Every
+result is also compared with the lazy expression of lvalues, which must give exactly the same
+magnitudes.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "allocation_counter.hpp"
+
+using allocation_counter::allocations;
+
+namespace {
+	auto make_vector(int dimensions, double offset) -> comp6771::euclidean_vector {
+		auto vector = comp6771::euclidean_vector(dimensions);
+		for (auto i = 0; i < dimensions; i++) {
+			vector[i] = std::sin(i + offset);
+		}
+		return vector;
+	}
+} // namespace
+
+TEST_CASE("operators reuse the storage of temporary euclidean_vectors") {
+	auto const dimensions = comp6771::euclidean_vector::inline_capacity + 5;
+	auto const a = make_vector(dimensions, 0.5);
+	auto const b = make_vector(dimensions, 1.5);
+	auto const c = make_vector(dimensions, 2.5);
+
+	SECTION("operators give euclidean_vectors unless an operand is lazy") {
+		using vector = comp6771::euclidean_vector;
+		auto temporary = a;
+		static_assert(std::is_same_v<decltype(std::move(temporary) + b), vector>);
+		static_assert(std::is_same_v<decltype(b - std::move(temporary)), vector>);
+		static_assert(std::is_same_v<decltype(2 * std::move(temporary)), vector>);
+		static_assert(std::is_same_v<decltype(-std::move(temporary)), vector>);
+		static_assert(std::is_same_v<decltype(a + b), vector>);
+		static_assert(std::is_same_v<decltype(a * 2), vector>);
+		static_assert(comp6771::vector_expression<decltype(comp6771::lazy(a) + b)>);
+		static_assert(comp6771::vector_expression<decltype(comp6771::lazy(a) * 2)>);
+	}
+
+	SECTION("a chain on a temporary allocates nothing") {
+		auto first = a;
+		auto* const buffer = &first[0];
+		auto const before = allocations;
+		// c * 2 on its own would allocate its result, so it is lazy
+		auto result = std::move(first) + b - comp6771::lazy(c) * 2 + a;
+		auto const after = allocations;
+		CHECK(after == before);
+		CHECK(&result[0] == buffer);
+		CHECK(result == comp6771::euclidean_vector(a + b - c * 2 + a));
+		CHECK(first.dimensions() == 0);
+	}
+
+	SECTION("a temporary on the right is reused too") {
+		auto second = b;
+		auto* const buffer = &second[0];
+		auto const before = allocations;
+		auto difference = a - std::move(second);
+		auto const after = allocations;
+		CHECK(after == before);
+		CHECK(&difference[0] == buffer);
+		CHECK(difference == comp6771::euclidean_vector(a - b));
+
+		auto sum = a * 3 + comp6771::euclidean_vector(b);
+		CHECK(sum == comp6771::euclidean_vector(a * 3 + b));
+		auto both = comp6771::euclidean_vector(a) - comp6771::euclidean_vector(c);
+		CHECK(both == comp6771::euclidean_vector(a - c));
+	}
+
+	SECTION("scaling, negation and unit work in place") {
+		auto vector = a;
+		auto* const buffer = &vector[0];
+		auto const before = allocations;
+		auto result = 2 * (std::move(vector) * 3 / 4);
+		result = -std::move(result);
+		result = comp6771::unit(std::move(result));
+		auto const after = allocations;
+		CHECK(after == before);
+		CHECK(&result[0] == buffer);
+
+		auto const expected = comp6771::euclidean_vector(a * 3 / 4 * 2);
+		auto const negated = comp6771::euclidean_vector(expected * -1);
+		CHECK(result == comp6771::unit(negated));
+	}
+
+	SECTION("errors are the same as for lvalues") {
+		auto const small = comp6771::euclidean_vector(2);
+		auto const size = std::to_string(dimensions);
+		CHECK_THROWS_WITH(comp6771::euclidean_vector(a) + small,
+		                  "Dimensions of LHS(" + size + ") and RHS(2) do not match");
+		CHECK_THROWS_WITH(small - comp6771::euclidean_vector(a),
+		                  "Dimensions of LHS(2) and RHS(" + size + ") do not match");
+		CHECK_THROWS_WITH(comp6771::euclidean_vector(a) / 0, "Invalid vector division by 0");
+		CHECK_THROWS_WITH(comp6771::unit(comp6771::euclidean_vector(3)),
+		                  "euclidean_vector with zero euclidean normal does not have a unit vector");
+		CHECK_THROWS_WITH(comp6771::unit(comp6771::euclidean_vector(0)),
+		                  "euclidean_vector with no dimensions does not have a unit vector");
+	}
+}
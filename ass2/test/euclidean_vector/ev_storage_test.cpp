@@ -0,0 +1,110 @@
+/*
+rationale:
+Each section checks where a euclidean_vector keeps its magnitudes. Vectors with up to
+inline_capacity dimensions should never touch the heap, and bigger ones should allocate exactly
+once and hand their block over when moved. Allocations are counted by replacing the global operator
+new (allocation_counter.hpp), and every check also compares the magnitudes, so storage changes
+cannot change results.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.hpp"
+
+using allocation_counter::allocations;
+
+TEST_CASE("small vectors are stored inline and big ones on the heap") {
+	auto const small_dimensions = comp6771::euclidean_vector::inline_capacity;
+	auto const big_dimensions = comp6771::euclidean_vector::inline_capacity + 1;
+
+	SECTION("small vectors never allocate") {
+		auto const before_default = allocations;
+		auto const default_constructed = comp6771::euclidean_vector();
+		auto const after_default = allocations;
+		auto const before = allocations;
+		auto const filled = comp6771::euclidean_vector(small_dimensions, 2.5);
+		auto copied = filled;
+		auto moved = std::move(copied);
+		moved *= 2;
+		auto const sum = comp6771::euclidean_vector(moved + filled);
+		auto const after = allocations;
+		CHECK(after == before);
+		// the default vector has one dimension
+		CHECK((after_default == before_default) == (small_dimensions >= 1));
+		CHECK(default_constructed.dimensions() == 1);
+		CHECK(default_constructed[0] == 0.0);
+		CHECK(sum == comp6771::euclidean_vector(small_dimensions, 7.5));
+		CHECK(copied.dimensions() == 0);
+	}
+
+	SECTION("big vectors allocate once and moves hand the block over") {
+		auto const before = allocations;
+		auto big = comp6771::euclidean_vector(big_dimensions, 1.0);
+		auto const after_construction = allocations;
+		auto moved = std::move(big);
+		auto assigned = comp6771::euclidean_vector(0);
+		assigned = std::move(moved);
+		auto const after_moves = allocations;
+		CHECK(after_construction - before == 1);
+		CHECK(after_moves == after_construction);
+		CHECK(assigned == comp6771::euclidean_vector(big_dimensions, 1.0));
+		CHECK(big.dimensions() == 0);
+		CHECK(moved.dimensions() == 0);
+	}
+
+	SECTION("assignment moves between inline and heap storage") {
+		auto const small = comp6771::euclidean_vector(small_dimensions, 3.0);
+		auto const big = comp6771::euclidean_vector(big_dimensions, 4.0);
+		auto vector = small;
+		vector = big;
+		CHECK(vector == big);
+		vector = small;
+		CHECK(vector == small);
+		vector = comp6771::euclidean_vector(big);
+		CHECK(vector == big);
+
+		// same dimensions copy into the existing block
+		auto const other_big = comp6771::euclidean_vector(big_dimensions, -1.0);
+		auto const before = allocations;
+		vector = other_big;
+		auto const after = allocations;
+		CHECK(after == before);
+		CHECK(vector == other_big);
+	}
+
+	SECTION("moved-from vectors can be reused") {
+		auto vector = comp6771::euclidean_vector{1.0, 2.0, 3.0};
+		auto taken = std::move(vector);
+		CHECK(vector.dimensions() == 0);
+		CHECK(static_cast<std::vector<double>>(vector).empty());
+		vector = taken;
+		CHECK(vector == comp6771::euclidean_vector{1.0, 2.0, 3.0});
+		vector = std::move(vector);
+		CHECK(vector == taken);
+	}
+
+	SECTION("negative dimensions throw instead of being stored") {
+		CHECK_THROWS_WITH(comp6771::euclidean_vector(-3), "Invalid vector dimensions -3");
+		CHECK_THROWS_WITH(comp6771::euclidean_vector(-1, 2.0), "Invalid vector dimensions -1");
+		CHECK(comp6771::euclidean_vector(0).dimensions() == 0);
+	}
+
+	SECTION("comparisons never allocate") {
+		auto const big = comp6771::euclidean_vector(big_dimensions, 1.0);
+		auto const same = comp6771::euclidean_vector(big_dimensions, 1.0);
+		auto const other = comp6771::euclidean_vector(big_dimensions, 2.0);
+		auto const before = allocations;
+		auto const equal = big == same;
+		auto const not_equal = big != other;
+		auto const after = allocations;
+		CHECK(after == before);
+		CHECK(equal);
+		CHECK(not_equal);
+		CHECK(big != comp6771::euclidean_vector(small_dimensions, 1.0));
+	}
+}
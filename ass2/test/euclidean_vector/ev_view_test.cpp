@@ -0,0 +1,105 @@
+/*
+rationale:
+Each section checks euclidean_vector_view over memory it does not own (a plain std::vector standing
+in for a big embedding buffer). Results are compared against euclidean_vectors holding the same
+magnitudes, writes through mutable views are checked in the underlying buffer, and the type checks
+make sure a euclidean_vector cannot be written through a view, which would skip its norm cache.
+*/
+
+#include <comp6771/euclidean_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <span>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("euclidean_vector_view works on external memory without copying") {
+	using mutable_view = comp6771::euclidean_vector_view<double>;
+	using const_view = comp6771::euclidean_vector_view<double const>;
+
+	// two rows of three magnitudes, back to back
+	auto buffer = std::vector<double>{3, -4, 12, 1, 2, 3};
+	auto const first = mutable_view(buffer.data(), 3);
+	auto const second = mutable_view(std::span<double>(buffer).subspan(3));
+	auto const first_copy = comp6771::euclidean_vector{3, -4, 12};
+	auto const second_copy = comp6771::euclidean_vector{1, 2, 3};
+
+	SECTION("views look at the buffer") {
+		CHECK(first.dimensions() == 3);
+		CHECK(first.data() == buffer.data());
+		CHECK(second.data() == buffer.data() + 3);
+		CHECK(second[2] == 3);
+		CHECK(second.at(0) == 1);
+		CHECK_THROWS_WITH(second.at(3), "Index 3 is not valid for this euclidean_vector object");
+		CHECK(const_view().dimensions() == 0);
+		first[1] = 4;
+		CHECK(buffer[1] == 4);
+	}
+
+	SECTION("utility functions and comparisons match euclidean_vector") {
+		CHECK(comp6771::euclidean_norm(first) == comp6771::euclidean_norm(first_copy));
+		CHECK(comp6771::dot(first, second) == comp6771::dot(first_copy, second_copy));
+		CHECK(comp6771::dot(first, second_copy) == comp6771::dot(first_copy, second));
+		CHECK(comp6771::unit(second) == comp6771::unit(second_copy));
+		CHECK(first == first_copy);
+		CHECK(first_copy == first);
+		CHECK(first != second);
+		CHECK(comp6771::euclidean_vector(second) == second_copy);
+		CHECK_THROWS_WITH(comp6771::dot(first, mutable_view(buffer.data(), 2)),
+		                  "Dimensions of LHS(3) and RHS(2) do not match");
+		CHECK_THROWS_WITH(comp6771::unit(const_view()),
+		                  "euclidean_vector with no dimensions does not have a unit vector");
+
+		auto view_output = std::ostringstream();
+		view_output << first;
+		auto copy_output = std::ostringstream();
+		copy_output << first_copy;
+		CHECK(view_output.str() == copy_output.str());
+	}
+
+	SECTION("arithmetic operators take views") {
+		auto const sum = comp6771::euclidean_vector(first + second * 2 - first_copy / 2);
+		CHECK(sum == comp6771::euclidean_vector(first_copy + second_copy * 2 - first_copy / 2));
+		CHECK_THROWS_WITH(first / 0, "Invalid vector division by 0");
+
+		auto vector = comp6771::euclidean_vector{1, 1, 1};
+		CHECK(comp6771::euclidean_norm(vector) == std::sqrt(3));
+		vector += second;
+		CHECK(vector == comp6771::euclidean_vector{2, 3, 4});
+		CHECK(comp6771::euclidean_norm(vector) == std::sqrt(29));
+		vector -= first;
+		CHECK(vector == comp6771::euclidean_vector{-1, 7, -8});
+	}
+
+	SECTION("compound operations write through mutable views") {
+		auto row = mutable_view(buffer.data(), 3);
+		row += second;
+		CHECK(buffer == std::vector<double>{4, -2, 15, 1, 2, 3});
+		row -= second_copy;
+		CHECK(buffer == std::vector<double>{3, -4, 12, 1, 2, 3});
+		row *= 2;
+		row /= 4;
+		CHECK(buffer == std::vector<double>{1.5, -2, 6, 1, 2, 3});
+		row += second * 2;
+		CHECK(buffer == std::vector<double>{3.5, 2, 12, 1, 2, 3});
+		CHECK_THROWS_WITH(row /= 0, "Invalid vector division by 0");
+		CHECK_THROWS_WITH(row += mutable_view(buffer.data(), 2),
+		                  "Dimensions of LHS(3) and RHS(2) do not match");
+	}
+
+	SECTION("euclidean_vectors only convert to const views") {
+		static_assert(std::is_convertible_v<comp6771::euclidean_vector const&, const_view>);
+		static_assert(std::is_convertible_v<mutable_view, const_view>);
+		static_assert(not std::is_constructible_v<mutable_view, comp6771::euclidean_vector&>);
+		static_assert(not std::is_constructible_v<mutable_view, const_view>);
+		static_assert(std::is_trivially_copyable_v<mutable_view>);
+
+		auto vector = first_copy;
+		auto const view = comp6771::euclidean_vector_view(vector);
+		static_assert(std::is_same_v<decltype(view), const_view const>);
+		vector[0] = 9;
+		CHECK(view[0] == 9);
+	}
+}